@@ -0,0 +1,1379 @@
+/**
+ *  @file benchmark.cpp
+ *  @brief Microbenchmarks measuring the dispatch cost of EasyDelegate against raw function pointers,
+ *  std::function and virtual calls.
+ *  @details Results are written to stdout as JSON so that they can be tracked across versions. Every
+ *  result is the median of several repetitions and is reported in nanoseconds per operation.
+ *
+ *  When run with --counters on Linux, hardware performance counters are read through perf_event_open
+ *  around each repetition and the counts of the median repetition are reported per operation as well.
+ *  Counters the kernel refuses to open are left out of the results.
+ *
+ *  When run with --stress, only the subscription churn scenario runs instead: invoking threads broadcast
+ *  through a shared DelegateSet while subscribing threads add and remove delegates, and the results report
+ *  invoke throughput, subscription latency percentiles and lock contention for each invoking thread count.
+ *  @date 10/16/2026
+ *  @author <a href="https://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Please refer to LICENSE.txt for more
+ *  information.
+ */
+
+#include <algorithm>        // std::sort
+#include <atomic>           // std::atomic
+#include <chrono>           // std::chrono::steady_clock
+#include <functional>       // std::function
+#include <iostream>         // std::cout, std::cerr, std::endl
+#include <math.h>           // ceil
+#include <mutex>            // std::mutex, std::lock_guard
+#include <stdlib.h>         // strtoul
+#include <string>           // std::string
+#include <string.h>         // strcmp, strerror
+#include <thread>           // std::thread
+#include <vector>           // std::vector
+
+#ifdef __linux__
+    #include <errno.h>              // errno
+    #include <linux/perf_event.h>   // perf_event_attr
+    #include <stdint.h>             // uint64_t
+    #include <sys/ioctl.h>          // ioctl
+    #include <sys/syscall.h>        // SYS_perf_event_open
+    #include <unistd.h>             // syscall, read, close
+#endif
+
+#include <easydelegate/easydelegate.hpp>
+
+using namespace std;
+
+//! The number of times each scenario is repeated. The median is reported.
+static const unsigned int sRepetitions = 7;
+
+//! The number of calls each invocation scenario aims to make per repetition, regardless of set size.
+static const size_t sCallsPerRepetition = 1 << 21;
+
+//! Sink written by handlers so that the compiler cannot discard their work.
+static volatile unsigned int sSink = 0;
+
+//! The names the hardware counters are reported under, in the order they are opened.
+static const char* sCounterNames[] = { "cycles", "instructions", "branch_misses", "l1d_read_misses", "llc_read_misses" };
+//! The number of hardware counters.
+static const size_t sCounterCount = sizeof(sCounterNames) / sizeof(sCounterNames[0]);
+
+/**
+ *  @brief The hardware performance counters read around each repetition when enabled.
+ *  @details Every counter is opened on its own rather than as a group, so that a counter the processor
+ *  or kernel does not support only removes that counter. Only user space is counted. Counts are scaled
+ *  by the fraction of time each counter was scheduled in case the kernel had to multiplex them.
+ */
+class PerformanceCounters
+{
+    public:
+        PerformanceCounters(void)
+        {
+            for (size_t counter = 0; counter < sCounterCount; ++counter)
+                mDescriptors[counter] = -1;
+        }
+
+        ~PerformanceCounters(void)
+        {
+            #ifdef __linux__
+                for (size_t counter = 0; counter < sCounterCount; ++counter)
+                    if (mDescriptors[counter] >= 0)
+                        close(mDescriptors[counter]);
+            #endif
+        }
+
+        /**
+         *  @brief Opens every counter the kernel permits.
+         *  @return Whether or not at least one counter was opened. When none were, the reason is written
+         *  to stderr.
+         */
+        bool open(void)
+        {
+            #ifdef __linux__
+                const uint32_t types[] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE };
+                const uint64_t configs[] =
+                {
+                    PERF_COUNT_HW_CPU_CYCLES,
+                    PERF_COUNT_HW_INSTRUCTIONS,
+                    PERF_COUNT_HW_BRANCH_MISSES,
+                    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+                    PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+                };
+
+                bool opened = false;
+                int error = 0;
+                for (size_t counter = 0; counter < sCounterCount; ++counter)
+                {
+                    perf_event_attr attributes;
+                    memset(&attributes, 0, sizeof(attributes));
+                    attributes.size = sizeof(attributes);
+                    attributes.type = types[counter];
+                    attributes.config = configs[counter];
+                    attributes.disabled = 1;
+                    attributes.exclude_kernel = 1;
+                    attributes.exclude_hv = 1;
+                    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+                    mDescriptors[counter] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+                    if (mDescriptors[counter] >= 0)
+                        opened = true;
+                    else
+                        error = errno;
+                }
+
+                if (!opened)
+                {
+                    cerr << "Hardware counters are unavailable: " << strerror(error) << "." << endl;
+                    if (error == EACCES || error == EPERM)
+                        cerr << "Lower /proc/sys/kernel/perf_event_paranoid or grant CAP_PERFMON to enable them." << endl;
+                    cerr << "Reporting wall clock time only." << endl;
+                }
+
+                return opened;
+            #else
+                cerr << "Hardware counters are only supported on Linux. Reporting wall clock time only." << endl;
+                return false;
+            #endif
+        }
+
+        //! Resets and starts every open counter.
+        void start(void)
+        {
+            #ifdef __linux__
+                for (size_t counter = 0; counter < sCounterCount; ++counter)
+                {
+                    if (mDescriptors[counter] < 0)
+                        continue;
+
+                    ioctl(mDescriptors[counter], PERF_EVENT_IOC_RESET, 0);
+                    ioctl(mDescriptors[counter], PERF_EVENT_IOC_ENABLE, 0);
+                }
+            #endif
+        }
+
+        /**
+         *  @brief Stops every open counter and reads it.
+         *  @param counts Written with the scaled count of each counter, or -1 for counters that are not open.
+         */
+        void stop(double* counts)
+        {
+            #ifdef __linux__
+                for (size_t counter = 0; counter < sCounterCount; ++counter)
+                    if (mDescriptors[counter] >= 0)
+                        ioctl(mDescriptors[counter], PERF_EVENT_IOC_DISABLE, 0);
+
+                for (size_t counter = 0; counter < sCounterCount; ++counter)
+                {
+                    // The value followed by the time enabled and the time running
+                    uint64_t values[3];
+                    counts[counter] = -1;
+
+                    if (mDescriptors[counter] < 0 || ::read(mDescriptors[counter], values, sizeof(values)) != sizeof(values) || !values[2])
+                        continue;
+
+                    counts[counter] = static_cast<double>(values[0]) * values[1] / values[2];
+                }
+            #else
+                for (size_t counter = 0; counter < sCounterCount; ++counter)
+                    counts[counter] = -1;
+            #endif
+        }
+
+    private:
+        //! The file descriptor of each counter, or -1 if it is not open.
+        int mDescriptors[sCounterCount];
+};
+
+//! The hardware counters, or NULL when they are not enabled.
+static PerformanceCounters* sCounters = NULL;
+
+//! The counts of the median repetition of the last measured scenario, or -1 where unavailable.
+static double sMeasuredCounts[sCounterCount];
+
+//! A single benchmark result.
+struct Result
+{
+    //! The name of the scenario.
+    string mName;
+    //! The set size the scenario ran against, or 0 where it does not apply.
+    size_t mSize;
+    //! The median time per operation in nanoseconds.
+    double mNanoseconds;
+    //! The number of operations timed per repetition.
+    size_t mOperations;
+    //! The hardware counts per operation of the median repetition, or -1 where unavailable.
+    double mCounts[sCounterCount];
+};
+
+//! Every result measured, written out as JSON once all scenarios ran.
+static vector<Result> sResults;
+
+//! The result of a single subscription churn run.
+struct StressResult
+{
+    //! The name of the DelegateSet variant.
+    string mVariant;
+    //! The number of invoking threads.
+    unsigned int mInvokers;
+    //! The number of subscribing threads.
+    unsigned int mSubscribers;
+    //! The subscriptions and unsubscriptions each subscribing thread attempts per second, or 0 for unthrottled.
+    unsigned int mChurnRate;
+
+    //! Broadcasts per second across all invoking threads.
+    double mInvokesPerSecond;
+    //! Delegate invocations per second across all invoking threads.
+    double mListenerCallsPerSecond;
+    //! Deferred broadcasts dispatched through the invoking threads' queues.
+    size_t mDeferredDispatches;
+
+    //! The 50th, 99th and 99.9th percentile subscription latencies in nanoseconds.
+    double mSubscribeLatency[3];
+    //! The 50th, 99th and 99.9th percentile unsubscription latencies in nanoseconds.
+    double mUnsubscribeLatency[3];
+
+    //! The number of times the set's lock was acquired.
+    size_t mLockAcquisitions;
+    //! The number of acquisitions that found the lock held.
+    size_t mContendedAcquisitions;
+    //! The total time spent waiting for the lock in nanoseconds.
+    double mLockWaitNanoseconds;
+};
+
+//! Every subscription churn result, written out as JSON once all runs finished.
+static vector<StressResult> sStressResults;
+
+//! A single repetition of a scenario.
+struct Sample
+{
+    //! The time taken in nanoseconds.
+    double mNanoseconds;
+    //! The hardware counts, or -1 where unavailable.
+    double mCounts[sCounterCount];
+
+    bool operator <(const Sample& other) const { return mNanoseconds < other.mNanoseconds; }
+};
+
+/**
+ *  @brief Runs a scenario several times and returns the median time in nanoseconds.
+ *  @details The hardware counts of the median repetition are left in sMeasuredCounts.
+ */
+template <typename setupType, typename runType>
+static double measure(setupType setup, runType run)
+{
+    vector<Sample> samples;
+
+    for (unsigned int repetition = 0; repetition < sRepetitions; ++repetition)
+    {
+        setup();
+
+        Sample sample;
+        if (sCounters)
+            sCounters->start();
+
+        const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        run();
+        sample.mNanoseconds = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+
+        if (sCounters)
+            sCounters->stop(sample.mCounts);
+        else
+            fill(sample.mCounts, sample.mCounts + sCounterCount, -1.0);
+
+        samples.push_back(sample);
+    }
+
+    sort(samples.begin(), samples.end());
+
+    const Sample& median = samples[samples.size() / 2];
+    copy(median.mCounts, median.mCounts + sCounterCount, sMeasuredCounts);
+    return median.mNanoseconds;
+}
+
+//! Records the result of a scenario.
+static void report(const char* name, const size_t& size, const double& nanoseconds, const size_t& operations)
+{
+    Result result;
+    result.mName = name;
+    result.mSize = size;
+    result.mNanoseconds = nanoseconds / operations;
+    result.mOperations = operations;
+
+    for (size_t counter = 0; counter < sCounterCount; ++counter)
+        result.mCounts[counter] = sMeasuredCounts[counter] < 0 ? -1 : sMeasuredCounts[counter] / operations;
+
+    sResults.push_back(result);
+}
+
+//! Writes every recorded result to stdout as JSON.
+static void writeResults(void)
+{
+    cout << "{" << endl;
+    cout << "    \"library\": \"EasyDelegate\"," << endl;
+    cout << "    \"version\": \"3.0\"," << endl;
+
+    #ifdef EASYDELEGATE_NO_DEFERRED_CALLING
+        cout << "    \"deferred_calling\": false," << endl;
+    #else
+        cout << "    \"deferred_calling\": true," << endl;
+    #endif
+
+    cout << "    \"hardware_counters\": " << (sCounters ? "true" : "false") << "," << endl;
+    cout << "    \"results\": [" << endl;
+
+    for (size_t index = 0; index < sResults.size(); ++index)
+    {
+        const Result& result = sResults[index];
+
+        cout << "        { \"name\": \"" << result.mName << "\", \"size\": " << result.mSize
+             << ", \"ns_per_op\": " << result.mNanoseconds << ", \"operations\": " << result.mOperations;
+
+        for (size_t counter = 0; counter < sCounterCount; ++counter)
+            if (result.mCounts[counter] >= 0)
+                cout << ", \"" << sCounterNames[counter] << "_per_op\": " << result.mCounts[counter];
+
+        cout << " }";
+        cout << (index + 1 < sResults.size() ? "," : "") << endl;
+    }
+
+    cout << "    ]" << (sStressResults.empty() ? "" : ",") << endl;
+
+    if (!sStressResults.empty())
+    {
+        cout << "    \"stress\": [" << endl;
+
+        for (size_t index = 0; index < sStressResults.size(); ++index)
+        {
+            const StressResult& result = sStressResults[index];
+
+            cout << "        { \"variant\": \"" << result.mVariant << "\", \"invokers\": " << result.mInvokers
+                 << ", \"subscribers\": " << result.mSubscribers << ", \"churn_rate\": " << result.mChurnRate
+                 << ", \"invokes_per_second\": " << result.mInvokesPerSecond
+                 << ", \"listener_calls_per_second\": " << result.mListenerCallsPerSecond
+                 << ", \"deferred_dispatches\": " << result.mDeferredDispatches
+                 << ", \"subscribe_ns\": { \"p50\": " << result.mSubscribeLatency[0] << ", \"p99\": " << result.mSubscribeLatency[1]
+                 << ", \"p999\": " << result.mSubscribeLatency[2] << " }"
+                 << ", \"unsubscribe_ns\": { \"p50\": " << result.mUnsubscribeLatency[0] << ", \"p99\": " << result.mUnsubscribeLatency[1]
+                 << ", \"p999\": " << result.mUnsubscribeLatency[2] << " }"
+                 << ", \"lock_acquisitions\": " << result.mLockAcquisitions
+                 << ", \"contended_acquisitions\": " << result.mContendedAcquisitions
+                 << ", \"lock_wait_ns\": " << result.mLockWaitNanoseconds << " }";
+            cout << (index + 1 < sStressResults.size() ? "," : "") << endl;
+        }
+
+        cout << "    ]" << endl;
+    }
+
+    cout << "}" << endl;
+}
+
+//! The set sizes the invocation scenarios run against.
+static const size_t sInvokeSizes[] = { 1, 16, 256, 4096, 65536, 1048576 };
+//! The set sizes the removal scenarios run against. Removal is linear in the set size.
+static const size_t sRemovalSizes[] = { 16, 1024, 65536 };
+
+//! The number of times a set of the given size is invoked per repetition.
+static size_t passesFor(const size_t& size)
+{
+    return size >= sCallsPerRepetition ? 1 : sCallsPerRepetition / size;
+}
+
+//! The signature used by every invocation scenario.
+typedef EasyDelegate::DelegateSet<int, int> BenchmarkSetType;
+
+//! A static listener.
+static int staticListener(int value)
+{
+    sSink += value;
+    return value;
+}
+
+//! A second static listener, used as the target of removal.
+static int removedStaticListener(int value)
+{
+    sSink -= value;
+    return value;
+}
+
+//! A listener class for member delegates and virtual call baselines.
+class Listener
+{
+    public:
+        virtual ~Listener(void) { }
+
+        int onEvent(int value)
+        {
+            sSink += value;
+            return value;
+        }
+
+        int onRemovedEvent(int value)
+        {
+            sSink -= value;
+            return value;
+        }
+
+        virtual int onVirtualEvent(int value)
+        {
+            sSink += value;
+            return value;
+        }
+};
+
+//! A derived listener, so the virtual call baseline is not trivially devirtualized.
+class DerivedListener : public Listener
+{
+    public:
+        virtual int onVirtualEvent(int value)
+        {
+            sSink ^= value;
+            return value;
+        }
+};
+
+//! Times invoking every callable in a container for each set size.
+template <typename containerType, typename buildType, typename invokeType>
+static void benchmarkInvocation(const char* name, buildType build, invokeType invoke)
+{
+    for (size_t sizeIndex = 0; sizeIndex < sizeof(sInvokeSizes) / sizeof(sInvokeSizes[0]); ++sizeIndex)
+    {
+        const size_t size = sInvokeSizes[sizeIndex];
+        const size_t passes = passesFor(size);
+
+        containerType container;
+        build(container, size);
+
+        const double nanoseconds = measure([]() { }, [&]()
+        {
+            for (size_t pass = 0; pass < passes; ++pass)
+                invoke(container, static_cast<int>(pass));
+        });
+
+        report(name, size, nanoseconds, size * passes);
+    }
+}
+
+//! Owns the listener objects used by the member delegate and virtual call scenarios.
+static vector<Listener*> sListeners;
+
+//! Returns a listener object, alternating between both listener classes.
+static Listener* listenerFor(const size_t& index)
+{
+    while (sListeners.size() <= index)
+        sListeners.push_back(sListeners.size() % 2 ? new DerivedListener() : new Listener());
+
+    return sListeners[index];
+}
+
+//! Measures the baselines the delegate types are compared against.
+static void benchmarkBaselines(void)
+{
+    typedef int (*FunctionPointer)(int);
+
+    benchmarkInvocation<vector<FunctionPointer> >("baseline_function_pointer", [](vector<FunctionPointer>& container, const size_t& size)
+    {
+        container.assign(size, staticListener);
+    }, [](const vector<FunctionPointer>& container, int value)
+    {
+        for (auto it = container.begin(); it != container.end(); ++it)
+            (*it)(value);
+    });
+
+    benchmarkInvocation<vector<function<int(int)> > >("baseline_std_function", [](vector<function<int(int)> >& container, const size_t& size)
+    {
+        container.assign(size, function<int(int)>(staticListener));
+    }, [](const vector<function<int(int)> >& container, int value)
+    {
+        for (auto it = container.begin(); it != container.end(); ++it)
+            (*it)(value);
+    });
+
+    benchmarkInvocation<vector<Listener*> >("baseline_virtual_call", [](vector<Listener*>& container, const size_t& size)
+    {
+        for (size_t index = 0; index < size; ++index)
+            container.push_back(listenerFor(index));
+    }, [](const vector<Listener*>& container, int value)
+    {
+        for (auto it = container.begin(); it != container.end(); ++it)
+            (*it)->onVirtualEvent(value);
+    });
+}
+
+//! Measures invoking a DelegateSet holding each delegate type, and collecting return values.
+static void benchmarkDelegateSets(void)
+{
+    const auto invoke = [](const BenchmarkSetType& set, int value) { set.invoke(value); };
+
+    benchmarkInvocation<BenchmarkSetType>("static_delegate_invoke", [](BenchmarkSetType& set, const size_t& size)
+    {
+        for (size_t index = 0; index < size; ++index)
+            set.push_back(new BenchmarkSetType::StaticDelegateType(staticListener));
+    }, invoke);
+
+    benchmarkInvocation<BenchmarkSetType>("member_delegate_invoke", [](BenchmarkSetType& set, const size_t& size)
+    {
+        for (size_t index = 0; index < size; ++index)
+            set.push_back(new BenchmarkSetType::MemberDelegateType<Listener>(&Listener::onEvent, listenerFor(index)));
+    }, invoke);
+
+    benchmarkInvocation<BenchmarkSetType>("function_delegate_invoke", [](BenchmarkSetType& set, const size_t& size)
+    {
+        for (size_t index = 0; index < size; ++index)
+            set.push_back(new BenchmarkSetType::FunctionDelegateType([](int value) -> int
+            {
+                sSink += value;
+                return value;
+            }));
+    }, invoke);
+
+    BenchmarkSetType::ReturnSetType returns;
+    benchmarkInvocation<BenchmarkSetType>("static_delegate_invoke_collect", [&](BenchmarkSetType& set, const size_t& size)
+    {
+        returns.reserve(size);
+
+        for (size_t index = 0; index < size; ++index)
+            set.push_back(new BenchmarkSetType::StaticDelegateType(staticListener));
+    }, [&](const BenchmarkSetType& set, int value)
+    {
+        returns.clear();
+        set.invoke(returns, value);
+    });
+
+    BenchmarkSetType::ReturnSetType().swap(returns);
+}
+
+//! Measures invoking the FrozenDelegateSet produced by freezing a DelegateSet holding each delegate type.
+static void benchmarkFrozenDelegateSets(void)
+{
+    typedef BenchmarkSetType::FrozenDelegateSetType FrozenSetType;
+    const auto invoke = [](const FrozenSetType& frozen, int value) { frozen.invoke(value); };
+
+    benchmarkInvocation<FrozenSetType>("static_delegate_invoke_frozen", [](FrozenSetType& frozen, const size_t& size)
+    {
+        BenchmarkSetType set;
+        for (size_t index = 0; index < size; ++index)
+            set.push_back(new BenchmarkSetType::StaticDelegateType(staticListener));
+
+        frozen = set.freeze();
+    }, invoke);
+
+    benchmarkInvocation<FrozenSetType>("member_delegate_invoke_frozen", [](FrozenSetType& frozen, const size_t& size)
+    {
+        BenchmarkSetType set;
+        for (size_t index = 0; index < size; ++index)
+            set.push_back(new BenchmarkSetType::MemberDelegateType<Listener>(&Listener::onEvent, listenerFor(index)));
+
+        frozen = set.freeze();
+    }, invoke);
+}
+
+//! Fills a set with member delegates against distinct objects, with the removal target in the middle.
+static void buildRemovalSet(BenchmarkSetType& set, const size_t& size, const bool& targetIsStatic)
+{
+    for (size_t index = 0; index < size; ++index)
+    {
+        if (index != size / 2)
+            set.push_back(new BenchmarkSetType::MemberDelegateType<Listener>(&Listener::onEvent, listenerFor(index)));
+        else if (targetIsStatic)
+            set.push_back(new BenchmarkSetType::StaticDelegateType(removedStaticListener));
+        else
+            set.push_back(new BenchmarkSetType::MemberDelegateType<Listener>(&Listener::onRemovedEvent, listenerFor(index)));
+    }
+}
+
+//! Times a single call to a removal method against sets of each removal size.
+template <typename removeType>
+static void benchmarkRemoval(const char* name, const bool& targetIsStatic, removeType remove)
+{
+    for (size_t sizeIndex = 0; sizeIndex < sizeof(sRemovalSizes) / sizeof(sRemovalSizes[0]); ++sizeIndex)
+    {
+        const size_t size = sRemovalSizes[sizeIndex];
+
+        // Build the sets up front, so that timing each removal excludes building and destroying the set
+        vector<BenchmarkSetType*> sets;
+        for (unsigned int repetition = 0; repetition < sRepetitions; ++repetition)
+        {
+            sets.push_back(new BenchmarkSetType());
+            buildRemovalSet(*sets.back(), size, targetIsStatic);
+        }
+
+        size_t current = 0;
+        const double nanoseconds = measure([]() { }, [&]()
+        {
+            remove(*sets[current++], size);
+        });
+
+        for (auto it = sets.begin(); it != sets.end(); ++it)
+            delete *it;
+
+        report(name, size, nanoseconds, 1);
+    }
+}
+
+//! Measures each of the DelegateSet removal methods.
+static void benchmarkRemovals(void)
+{
+    benchmarkRemoval("remove_delegate_by_static_method", true, [](BenchmarkSetType& set, const size_t&)
+    {
+        set.removeDelegateByMethod(removedStaticListener);
+    });
+
+    benchmarkRemoval("remove_delegate_by_member_method", false, [](BenchmarkSetType& set, const size_t&)
+    {
+        set.removeDelegateByMethod(&Listener::onRemovedEvent);
+    });
+
+    benchmarkRemoval("remove_delegate_by_this_pointer", false, [](BenchmarkSetType& set, const size_t& size)
+    {
+        set.removeDelegateByThisPointer(listenerFor(size / 2));
+    });
+
+    benchmarkRemoval("remove_delegate", false, [](BenchmarkSetType& set, const size_t& size)
+    {
+        set.removeDelegate(set[size / 2]);
+    });
+}
+
+#ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+    //! Times dispatching every deferred caller in a container for each set size.
+    template <typename callerType, typename buildType>
+    static void benchmarkDeferredDispatch(const char* name, buildType build)
+    {
+        for (size_t sizeIndex = 0; sizeIndex < sizeof(sInvokeSizes) / sizeof(sInvokeSizes[0]); ++sizeIndex)
+        {
+            const size_t size = sInvokeSizes[sizeIndex];
+            const size_t passes = passesFor(size);
+
+            vector<callerType*> callers;
+            for (size_t index = 0; index < size; ++index)
+                callers.push_back(build(index));
+
+            const double nanoseconds = measure([]() { }, [&]()
+            {
+                for (size_t pass = 0; pass < passes; ++pass)
+                    for (auto it = callers.begin(); it != callers.end(); ++it)
+                        (*it)->genericDispatch();
+            });
+
+            for (auto it = callers.begin(); it != callers.end(); ++it)
+                delete *it;
+
+            report(name, size, nanoseconds, size * passes);
+        }
+    }
+
+    //! Measures dispatching each deferred caller type through IDeferredCaller::genericDispatch.
+    static void benchmarkDeferredCallers(void)
+    {
+        benchmarkDeferredDispatch<EasyDelegate::IDeferredCaller>("deferred_static_dispatch", [](const size_t& index)
+        {
+            return new BenchmarkSetType::DeferredStaticCallerType(staticListener, static_cast<int>(index));
+        });
+
+        benchmarkDeferredDispatch<EasyDelegate::IDeferredCaller>("deferred_member_dispatch", [](const size_t& index)
+        {
+            return new BenchmarkSetType::DeferredMemberCallerType<Listener>(&Listener::onEvent, listenerFor(index), static_cast<int>(index));
+        });
+
+        // A single broadcast over a set of each size, reported per delegate invoked
+        for (size_t sizeIndex = 0; sizeIndex < sizeof(sInvokeSizes) / sizeof(sInvokeSizes[0]); ++sizeIndex)
+        {
+            const size_t size = sInvokeSizes[sizeIndex];
+            const size_t passes = passesFor(size);
+
+            BenchmarkSetType set;
+            for (size_t index = 0; index < size; ++index)
+                set.push_back(new BenchmarkSetType::StaticDelegateType(staticListener));
+
+            EasyDelegate::IDeferredCaller* caller = set.deferInvoke(1);
+            const double nanoseconds = measure([]() { }, [&]()
+            {
+                for (size_t pass = 0; pass < passes; ++pass)
+                    caller->genericDispatch();
+            });
+
+            delete caller;
+            report("deferred_broadcast_dispatch", size, nanoseconds, size * passes);
+        }
+    }
+
+    //! Deterministic pseudo random numbers, so that every run measures the same mix.
+    static unsigned int nextRandom(unsigned int& state)
+    {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+    
+    /**
+     *  @brief A family of listener classes. Each instantiation has its own member methods, so a mix of
+     *  them spreads dispatch across many distinct code addresses as a real event system would.
+     */
+    template <unsigned int id>
+    class Handler
+    {
+        public:
+            Handler(void) : mState(id) { }
+
+            void onUpdate(int value)
+            {
+                for (unsigned int iteration = 0; iteration < (id % 4) + 1; ++iteration)
+                    mState = mState * 31 + value + iteration;
+
+                sSink += mState;
+            }
+
+            void onRender(int value)
+            {
+                mState ^= static_cast<unsigned int>(value) << (id % 8);
+                sSink += mState;
+            }
+
+        private:
+            unsigned int mState;
+    };
+
+    //! A static listener; each instantiation is a distinct function.
+    template <unsigned int id>
+    void staticHandler(int value)
+    {
+        sSink += static_cast<unsigned int>(value) * (id + 1);
+    }
+
+    //! The number of Handler instantiations in the mix.
+    static const unsigned int sHandlerTypes = 16;
+    //! The number of objects of each Handler instantiation.
+    static const unsigned int sObjectsPerType = 64;
+    //! The number of static handlers in the mix.
+    static const unsigned int sStaticHandlers = 8;
+
+    //! The number of words of state each LargeHandler object holds, 16 KiB.
+    static const size_t sLargeStateWords = 4096;
+    //! The distance between the words a LargeHandler call touches, so that each touches a different cache line.
+    static const size_t sLargeStateStride = 64;
+    //! The number of unrolled mixing steps in each LargeHandler method.
+    static const unsigned int sLargeMixSteps = 64;
+
+    //! Helper template unrolling a mixing step with its own constants for every id and step.
+    template <unsigned int id, unsigned int step>
+    struct MixSteps
+    {
+        static unsigned int apply(unsigned int value)
+        {
+            value = MixSteps<id, step - 1>::apply(value);
+            return (value ^ (value >> ((id + step) % 13 + 3))) * (0x9E3779B1u + 2 * (id * sLargeMixSteps + step));
+        }
+    };
+
+    template <unsigned int id>
+    struct MixSteps<id, 0>
+    {
+        static unsigned int apply(unsigned int value) { return value; }
+    };
+
+    /**
+     *  @brief A family of listener classes with a large code and data footprint. Each method unrolls its own
+     *  mixing steps, and each object holds 16 KiB of state of which every call touches 64 cache lines, so an
+     *  interleaved mix of them misses in the instruction and data caches unless calls to a target are grouped.
+     */
+    template <unsigned int id>
+    class LargeHandler
+    {
+        public:
+            LargeHandler(void) : mState(sLargeStateWords, id) { }
+
+            void onUpdate(int value)
+            {
+                unsigned int hash = MixSteps<id, sLargeMixSteps>::apply(static_cast<unsigned int>(value));
+                for (size_t word = 0; word < mState.size(); word += sLargeStateStride)
+                    hash = hash * 31 + (mState[word] += hash);
+
+                sSink += hash;
+            }
+
+            void onRender(int value)
+            {
+                unsigned int hash = MixSteps<id + sHandlerTypes, sLargeMixSteps>::apply(static_cast<unsigned int>(value));
+                for (size_t word = sLargeStateStride / 2; word < mState.size(); word += sLargeStateStride)
+                    hash ^= (mState[word] ^= hash << (id % 8));
+
+                sSink += hash;
+            }
+
+        private:
+            vector<unsigned int> mState;
+    };
+
+    //! Creates a deferred call to one of the Handler instantiation's methods against one of its objects.
+    typedef EasyDelegate::IDeferredCaller* (*CallFactory)(unsigned int random, int value);
+
+    template <template <unsigned int> class handlerType, unsigned int id>
+    EasyDelegate::IDeferredCaller* makeHandlerCall(unsigned int random, int value)
+    {
+        static vector<handlerType<id> > objects(sObjectsPerType);
+
+        handlerType<id>* object = &objects[random % sObjectsPerType];
+        if ((random / sObjectsPerType) % 2)
+            return new EasyDelegate::DeferredMemberCaller<handlerType<id>, void, int>(&handlerType<id>::onUpdate, object, value);
+
+        return new EasyDelegate::DeferredMemberCaller<handlerType<id>, void, int>(&handlerType<id>::onRender, object, value);
+    }
+
+    template <unsigned int id>
+    EasyDelegate::IDeferredCaller* makeStaticCall(unsigned int, int value)
+    {
+        return new EasyDelegate::DeferredStaticCaller<void, int>(staticHandler<id>, value);
+    }
+
+    //! Helper template populating the table of call factories for a family of handlers at compile time.
+    template <template <unsigned int> class handlerType, unsigned int count>
+    struct CallFactories
+    {
+        static void append(vector<CallFactory>& factories)
+        {
+            CallFactories<handlerType, count - 1>::append(factories);
+            factories.push_back(makeHandlerCall<handlerType, count - 1>);
+
+            if (count <= sStaticHandlers)
+                factories.push_back(makeStaticCall<count - 1>);
+        }
+    };
+
+    template <template <unsigned int> class handlerType>
+    struct CallFactories<handlerType, 0>
+    {
+        static void append(vector<CallFactory>&) { }
+    };
+
+    /**
+     *  @brief Measures draining a queue holding an interleaved mix of deferred calls from the given factories,
+     *  in the order they were pushed and then grouped for locality. The grouped timing includes the cost of
+     *  grouping.
+     */
+    static void benchmarkQueueMix(const vector<CallFactory>& factories, const char* fifoName, const char* localityName)
+    {
+        const size_t callCounts[] = { 1000, 10000, 200000 };
+
+        for (size_t countIndex = 0; countIndex < sizeof(callCounts) / sizeof(callCounts[0]); ++countIndex)
+        {
+            const size_t callCount = callCounts[countIndex];
+
+            for (unsigned int locality = 0; locality < 2; ++locality)
+            {
+                EasyDelegate::DeferredCallQueue queue;
+                queue.setLocalityOrdering(locality != 0);
+
+                const double nanoseconds = measure([&]()
+                {
+                    unsigned int random = 1;
+                    for (size_t call = 0; call < callCount; ++call)
+                    {
+                        const unsigned int selection = nextRandom(random);
+                        queue.push(factories[selection % factories.size()](selection / factories.size(), static_cast<int>(call)));
+                    }
+                }, [&]()
+                {
+                    queue.drain();
+                });
+
+                report(locality ? localityName : fifoName, callCount, nanoseconds, callCount);
+            }
+        }
+    }
+
+    /**
+     *  @brief Measures draining realistic mixes of deferred calls in FIFO and grouped order, first with small
+     *  handlers and then with handlers whose code and data overflow the caches when interleaved.
+     */
+    static void benchmarkQueueLocality(void)
+    {
+        vector<CallFactory> factories;
+        CallFactories<Handler, sHandlerTypes>::append(factories);
+        benchmarkQueueMix(factories, "deferred_queue_drain_fifo", "deferred_queue_drain_locality");
+
+        vector<CallFactory> largeFactories;
+        CallFactories<LargeHandler, sHandlerTypes>::append(largeFactories);
+        benchmarkQueueMix(largeFactories, "deferred_queue_drain_fifo_large", "deferred_queue_drain_locality_large");
+    }
+
+    //! Set by the call the aging scenario waits for.
+    static bool sAgedCallDispatched = false;
+
+    //! The call the aging scenario waits for.
+    static void agedCall(int)
+    {
+        sAgedCallDispatched = true;
+    }
+
+    /**
+     *  @brief Measures how many budgeted drains an old call waits while locality ordering groups it behind
+     *  newer calls to another method, with every drain pushing more of those and more urgent calls besides.
+     *  @details The reported size is the number of drains the old call waited. Aging has to dispatch it
+     *  regardless of where grouping places it.
+     *  @return Whether or not the old call was dispatched within the number of drains aging allows.
+     */
+    static bool benchmarkQueueAging(void)
+    {
+        const unsigned int priorityCount = 2;
+        const size_t agingThreshold = 3;
+        // The call waits the threshold in each class, then behind calls that became overdue before it
+        const size_t drainLimit = 4 * priorityCount * agingThreshold;
+
+        EasyDelegate::DeferredCallQueue queue(priorityCount, agingThreshold);
+        queue.setLocalityOrdering(true);
+
+        size_t drains = 0;
+        const double nanoseconds = measure([&]()
+        {
+            queue.clear();
+            queue.push(makeStaticCall<1>(0, 0), 1);
+            queue.push(new EasyDelegate::DeferredStaticCaller<void, int>(agedCall, 0), 1);
+
+            sAgedCallDispatched = false;
+            drains = 0;
+        }, [&]()
+        {
+            while (!sAgedCallDispatched && drains < drainLimit)
+            {
+                queue.push(makeStaticCall<1>(0, static_cast<int>(drains)), 1);
+                queue.push(makeStaticCall<2>(0, static_cast<int>(drains)), 0);
+                queue.drain(EasyDelegate::DrainBudget::calls(1));
+                ++drains;
+            }
+        });
+
+        report("deferred_queue_aging_locality", drains, nanoseconds, drains);
+        return sAgedCallDispatched;
+    }
+#endif
+
+//! Sink written by the stress listeners. Thread local, so that concurrent variants do not race on it.
+static thread_local unsigned int sStressSink = 0;
+
+//! The listener subscribed by the stress scenario.
+static int stressListener(int value)
+{
+    sStressSink += value;
+    return value;
+}
+
+/**
+ *  @brief A mutex that counts how often it is acquired while held and how long acquirers wait for it.
+ *  @details Counters are only updated while the mutex is held, so they need no synchronization of their own.
+ */
+class ContentionMutex
+{
+    public:
+        ContentionMutex(void) : mAcquisitions(0), mContendedAcquisitions(0), mWaitNanoseconds(0) { }
+
+        void lock(void)
+        {
+            if (mMutex.try_lock())
+            {
+                ++mAcquisitions;
+                return;
+            }
+
+            const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            mMutex.lock();
+
+            ++mAcquisitions;
+            ++mContendedAcquisitions;
+            mWaitNanoseconds += chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+        }
+
+        void unlock(void) { mMutex.unlock(); }
+
+        //! The number of times the mutex was acquired.
+        size_t mAcquisitions;
+        //! The number of acquisitions that found the mutex held.
+        size_t mContendedAcquisitions;
+        //! The total time spent waiting for the mutex in nanoseconds.
+        double mWaitNanoseconds;
+
+    private:
+        std::mutex mMutex;
+};
+
+/**
+ *  @brief The vector backed DelegateSet, with every access serialized by a single mutex.
+ *  @details Every variant run by benchmarkStress provides the same methods: getName, invoke, subscribe,
+ *  unsubscribe, deferInvoke, drain and getMutex.
+ */
+class MutexDelegateSet
+{
+    public:
+        static const char* getName(void) { return "mutex_delegate_set"; }
+
+        //! Broadcasts to every delegate, returning the number invoked.
+        size_t invoke(int value)
+        {
+            std::lock_guard<ContentionMutex> lock(mMutex);
+            mSet.invoke(value);
+            return mSet.size();
+        }
+
+        void subscribe(BenchmarkSetType::StoredDelegateType* delegateInstance)
+        {
+            std::lock_guard<ContentionMutex> lock(mMutex);
+            mSet += delegateInstance;
+        }
+
+        void unsubscribe(BenchmarkSetType::StoredDelegateType* delegateInstance)
+        {
+            std::lock_guard<ContentionMutex> lock(mMutex);
+            mSet.removeDelegate(delegateInstance);
+        }
+
+        #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+            EasyDelegate::IDeferredCaller* deferInvoke(int value) const { return mSet.deferInvoke(value); }
+
+            //! Drains a queue of deferred broadcasts referring to this set, returning the number dispatched.
+            size_t drain(EasyDelegate::DeferredCallQueue& queue)
+            {
+                std::lock_guard<ContentionMutex> lock(mMutex);
+                return queue.drain();
+            }
+        #endif
+
+        const ContentionMutex& getMutex(void) const { return mMutex; }
+
+    private:
+        ContentionMutex mMutex;
+        BenchmarkSetType mSet;
+};
+
+//! Combiner counting the delegates invoked, so the count is taken under the set's own lock.
+class CountCombiner
+{
+    public:
+        typedef size_t ResultType;
+
+        CountCombiner(void) : mResult(0) { }
+
+        void combine(int) { ++mResult; }
+
+        const ResultType& getResult(void) const { return mResult; }
+
+    private:
+        ResultType mResult;
+};
+
+/**
+ *  @brief The vector backed DelegateSet, with every access serialized by its own LockedPolicy.
+ *  @details Deferred broadcasts are snapshots taken under the set's lock, so unsubscribed delegates are retired
+ *  rather than deleted until the variant is destroyed, as a queued snapshot may still refer to them.
+ */
+class LockedPolicyDelegateSet
+{
+    public:
+        typedef EasyDelegate::BasicDelegateSet<int(int), EasyDelegate::LockedPolicy<ContentionMutex> > SetType;
+
+        static const char* getName(void) { return "locked_policy_delegate_set"; }
+
+        ~LockedPolicyDelegateSet(void)
+        {
+            for (auto it = mRetired.begin(); it != mRetired.end(); ++it)
+                delete *it;
+        }
+
+        //! Broadcasts to every delegate, returning the number invoked.
+        size_t invoke(int value) { return mSet.invoke(CountCombiner(), value); }
+
+        void subscribe(BenchmarkSetType::StoredDelegateType* delegateInstance) { mSet += delegateInstance; }
+
+        void unsubscribe(BenchmarkSetType::StoredDelegateType* delegateInstance)
+        {
+            mSet.removeDelegate(delegateInstance, false);
+
+            std::lock_guard<std::mutex> lock(mRetiredMutex);
+            mRetired.push_back(delegateInstance);
+        }
+
+        #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+            EasyDelegate::IDeferredCaller* deferInvoke(int value) const { return mSet.deferInvokeSnapshot(value); }
+
+            //! Drains a queue of deferred broadcasts snapshotting this set, returning the number dispatched.
+            size_t drain(EasyDelegate::DeferredCallQueue& queue) { return queue.drain(); }
+        #endif
+
+        const ContentionMutex& getMutex(void) const { return mSet.getThreadingPolicy().getMutex(); }
+
+    private:
+        SetType mSet;
+        std::mutex mRetiredMutex;
+        vector<BenchmarkSetType::StoredDelegateType*> mRetired;
+};
+
+//! The configuration of the subscription churn scenario.
+struct StressConfiguration
+{
+    //! The largest number of invoking threads. Runs double the count from 1 up to this.
+    unsigned int mMaximumInvokers;
+    //! The number of subscribing threads.
+    unsigned int mSubscribers;
+    //! The subscriptions and unsubscriptions each subscribing thread attempts per second, or 0 for unthrottled.
+    unsigned int mChurnRate;
+    //! The number of delegates subscribed before the run starts.
+    unsigned int mListeners;
+    //! The duration of each run in milliseconds.
+    unsigned int mDuration;
+
+    StressConfiguration(void) : mMaximumInvokers(64), mSubscribers(2), mChurnRate(1000), mListeners(64), mDuration(250) { }
+};
+
+//! Returns the given percentile of a sorted list of samples, or 0 if it is empty.
+static double percentileOf(const vector<double>& sorted, const double& percentile)
+{
+    if (sorted.empty())
+        return 0;
+
+    const size_t rank = static_cast<size_t>(ceil(percentile / 100.0 * sorted.size()));
+    return sorted[rank ? rank - 1 : 0];
+}
+
+//! The number of delegates each subscribing thread keeps subscribed before it starts unsubscribing its oldest.
+static const size_t sSubscriptionWindow = 8;
+//! The number of deferred broadcasts each invoking thread queues before draining.
+static const size_t sDeferredBatch = 16;
+//! Every how many broadcasts an invoking thread also queues a deferred broadcast.
+static const size_t sDeferredInterval = 4;
+
+/**
+ *  @brief Runs the subscription churn scenario against one variant with the given number of invoking threads.
+ *  @details Every invoking thread broadcasts as fast as it can, and every few broadcasts also queues a deferred
+ *  broadcast on its own DeferredCallQueue, draining the queue in batches. Every subscribing thread alternates
+ *  between subscribing new delegates and unsubscribing its oldest, timing each, paced to the churn rate.
+ */
+template <typename variantType>
+static void runStress(const StressConfiguration& configuration, const unsigned int& invokers)
+{
+    variantType set;
+    for (unsigned int listener = 0; listener < configuration.mListeners; ++listener)
+        set.subscribe(new BenchmarkSetType::StaticDelegateType(stressListener));
+
+    atomic<bool> started(false);
+    atomic<bool> stopped(false);
+    atomic<size_t> invokes(0);
+    atomic<size_t> listenerCalls(0);
+    atomic<size_t> deferredDispatches(0);
+
+    vector<vector<double> > subscribeLatencies(configuration.mSubscribers);
+    vector<vector<double> > unsubscribeLatencies(configuration.mSubscribers);
+
+    vector<thread> threads;
+    for (unsigned int invoker = 0; invoker < invokers; ++invoker)
+        threads.push_back(thread([&]()
+        {
+            size_t localInvokes = 0;
+            size_t localListenerCalls = 0;
+
+            #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+                EasyDelegate::DeferredCallQueue queue;
+                size_t localDispatches = 0;
+            #endif
+
+            while (!started.load(memory_order_acquire))
+                this_thread::yield();
+
+            while (!stopped.load(memory_order_relaxed))
+            {
+                const int value = static_cast<int>(localInvokes);
+                localListenerCalls += set.invoke(value);
+                ++localInvokes;
+
+                #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+                    if (localInvokes % sDeferredInterval == 0)
+                        queue.push(set.deferInvoke(value));
+
+                    if (queue.size() >= sDeferredBatch)
+                        localDispatches += set.drain(queue);
+                #endif
+            }
+
+            #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+                localDispatches += set.drain(queue);
+                deferredDispatches += localDispatches;
+            #endif
+
+            invokes += localInvokes;
+            listenerCalls += localListenerCalls;
+        }));
+
+    for (unsigned int subscriber = 0; subscriber < configuration.mSubscribers; ++subscriber)
+        threads.push_back(thread([&, subscriber]()
+        {
+            vector<double>& subscribeLatency = subscribeLatencies[subscriber];
+            vector<double>& unsubscribeLatency = unsubscribeLatencies[subscriber];
+            vector<BenchmarkSetType::StoredDelegateType*> subscribed;
+
+            const chrono::nanoseconds period(configuration.mChurnRate ? 1000000000 / configuration.mChurnRate : 0);
+
+            while (!started.load(memory_order_acquire))
+                this_thread::yield();
+
+            chrono::steady_clock::time_point next = chrono::steady_clock::now();
+            while (!stopped.load(memory_order_relaxed))
+            {
+                if (period.count())
+                {
+                    next += period;
+                    this_thread::sleep_until(next);
+                }
+
+                const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+                if (subscribed.size() < sSubscriptionWindow)
+                {
+                    BenchmarkSetType::StoredDelegateType* delegateInstance = new BenchmarkSetType::StaticDelegateType(stressListener);
+                    set.subscribe(delegateInstance);
+                    subscribed.push_back(delegateInstance);
+
+                    subscribeLatency.push_back(chrono::duration<double, nano>(chrono::steady_clock::now() - start).count());
+                }
+                else
+                {
+                    set.unsubscribe(subscribed.front());
+                    subscribed.erase(subscribed.begin());
+
+                    unsubscribeLatency.push_back(chrono::duration<double, nano>(chrono::steady_clock::now() - start).count());
+                }
+            }
+        }));
+
+    started.store(true, memory_order_release);
+    const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    this_thread::sleep_for(chrono::milliseconds(configuration.mDuration));
+    stopped.store(true, memory_order_relaxed);
+
+    for (auto it = threads.begin(); it != threads.end(); ++it)
+        it->join();
+
+    const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<double> subscribeLatency;
+    vector<double> unsubscribeLatency;
+    for (unsigned int subscriber = 0; subscriber < configuration.mSubscribers; ++subscriber)
+    {
+        subscribeLatency.insert(subscribeLatency.end(), subscribeLatencies[subscriber].begin(), subscribeLatencies[subscriber].end());
+        unsubscribeLatency.insert(unsubscribeLatency.end(), unsubscribeLatencies[subscriber].begin(), unsubscribeLatencies[subscriber].end());
+    }
+
+    sort(subscribeLatency.begin(), subscribeLatency.end());
+    sort(unsubscribeLatency.begin(), unsubscribeLatency.end());
+
+    const double percentiles[] = { 50, 99, 99.9 };
+
+    StressResult result;
+    result.mVariant = variantType::getName();
+    result.mInvokers = invokers;
+    result.mSubscribers = configuration.mSubscribers;
+    result.mChurnRate = configuration.mChurnRate;
+    result.mInvokesPerSecond = invokes / seconds;
+    result.mListenerCallsPerSecond = listenerCalls / seconds;
+    result.mDeferredDispatches = deferredDispatches;
+
+    for (size_t index = 0; index < 3; ++index)
+    {
+        result.mSubscribeLatency[index] = percentileOf(subscribeLatency, percentiles[index]);
+        result.mUnsubscribeLatency[index] = percentileOf(unsubscribeLatency, percentiles[index]);
+    }
+
+    result.mLockAcquisitions = set.getMutex().mAcquisitions;
+    result.mContendedAcquisitions = set.getMutex().mContendedAcquisitions;
+    result.mLockWaitNanoseconds = set.getMutex().mWaitNanoseconds;
+
+    sStressResults.push_back(result);
+}
+
+//! Runs the subscription churn scenario against every variant, doubling the invoking threads up to the maximum.
+static void benchmarkStress(const StressConfiguration& configuration)
+{
+    for (unsigned int invokers = 1; invokers <= configuration.mMaximumInvokers; invokers *= 2)
+    {
+        runStress<MutexDelegateSet>(configuration, invokers);
+        runStress<LockedPolicyDelegateSet>(configuration, invokers);
+    }
+}
+
+//! Parses the unsigned integer value following a command line option.
+static bool parseOption(int& argument, const int& argc, char* argv[], unsigned int& value)
+{
+    if (argument + 1 >= argc)
+        return false;
+
+    char* end;
+    value = static_cast<unsigned int>(strtoul(argv[++argument], &end, 10));
+    return *end == '\0';
+}
+
+int main(int argc, char *argv[])
+{
+    PerformanceCounters counters;
+    StressConfiguration stressConfiguration;
+    bool stress = false;
+
+    for (int argument = 1; argument < argc; ++argument)
+    {
+        bool valid = true;
+
+        if (!strcmp(argv[argument], "--counters"))
+        {
+            if (counters.open())
+                sCounters = &counters;
+        }
+        else if (!strcmp(argv[argument], "--stress"))
+            stress = true;
+        else if (!strcmp(argv[argument], "--invokers"))
+            valid = parseOption(argument, argc, argv, stressConfiguration.mMaximumInvokers) && stressConfiguration.mMaximumInvokers;
+        else if (!strcmp(argv[argument], "--subscribers"))
+            valid = parseOption(argument, argc, argv, stressConfiguration.mSubscribers);
+        else if (!strcmp(argv[argument], "--churn-rate"))
+            valid = parseOption(argument, argc, argv, stressConfiguration.mChurnRate);
+        else if (!strcmp(argv[argument], "--listeners"))
+            valid = parseOption(argument, argc, argv, stressConfiguration.mListeners);
+        else if (!strcmp(argv[argument], "--duration"))
+            valid = parseOption(argument, argc, argv, stressConfiguration.mDuration);
+        else
+            valid = false;
+
+        if (!valid)
+        {
+            cerr << "Usage: " << argv[0] << " [--counters] [--stress [--invokers MAX] [--subscribers K] [--churn-rate OPS_PER_SECOND]"
+                 << " [--listeners N] [--duration MILLISECONDS]]" << endl;
+            return 1;
+        }
+    }
+
+    if (stress)
+    {
+        benchmarkStress(stressConfiguration);
+        writeResults();
+        return 0;
+    }
+
+    benchmarkBaselines();
+    benchmarkDelegateSets();
+    benchmarkFrozenDelegateSets();
+    benchmarkRemovals();
+
+    bool aged = true;
+
+    #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+        benchmarkDeferredCallers();
+        benchmarkQueueLocality();
+        aged = benchmarkQueueAging();
+    #endif
+
+    writeResults();
+
+    for (auto it = sListeners.begin(); it != sListeners.end(); ++it)
+        delete *it;
+
+    if (!aged)
+    {
+        cerr << "A deferred call was starved past its aging threshold" << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -72,6 +72,10 @@ int main(int argc, char *argv[])
     for (auto it = myReturnValues.begin(); it != myReturnValues.end(); it++)
         cout << *it << endl;
 
+    // Call the set via .invoke(), folding returns into a combiner instead of storing them
+    cout << "------------- CALLING VIA .invoke(), Summing Returns ---------------" << endl;
+    cout << myDelegateSet.invoke(EasyDelegate::SumCombiner<unsigned int>(), "Foo", 3.14, 3.14159) << endl;
+
     // Iterate on our own, calling invoke() for each delegate
     cout << "------- CUSTOM ITERATION --------" << endl;
     for (auto it = myDelegateSet.begin(); it != myDelegateSet.end(); it++)
@@ -130,6 +134,21 @@ int main(int argc, char *argv[])
             cout << "Invoking Delegate " << endl;
             (*it)->genericDispatch();
         }
+
+        // Queue deferred calls by priority and drain them against a budget
+        cout << "---------- DEFERRED CALL QUEUE ---------------" << endl;
+        EasyDelegate::DeferredCallQueue queue(2, 4);
+
+        queue.push(new MyCachedVoidStaticDelegateType(myStaticVoidMethod, 1.0f, "Queued Low", 1.0), 1);
+        queue.push(new MyCachedVoidStaticDelegateType(myStaticVoidMethod, 2.0f, "Queued High", 2.0), 0);
+        queue.push(new MyCachedIntMemberDelegateType(&MyCustomClass::myMemberMethod, myCustomClassInstance, "Queued High", 3.0f, 3.0), 0);
+
+        // A whole set can be deferred too, caching the arguments only once
+        queue.push(myDelegateSet.deferInvoke("Queued Broadcast", 4.0f, 4.0), 1);
+
+        queue.drain(EasyDelegate::DrainBudget::calls(2));
+        cout << "Remaining after budgeted drain: " << queue.size() << endl;
+        queue.drain();
     #endif
 
     // Comparisons
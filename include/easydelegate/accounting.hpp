@@ -0,0 +1,330 @@
+/**
+ *  @file accounting.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the allocation accounting that is compiled in when
+ *  EASYDELEGATE_ALLOCATION_ACCOUNTING is defined, along with the StorageAllocator used by
+ *  every container the library owns.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_ACCOUNTING_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_ACCOUNTING_HPP_
+
+#include <memory>           // std::allocator
+
+#ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+    #include <atomic>       // std::atomic
+    #include <new>          // operator new, operator delete
+    #include <stddef.h>     // size_t
+    #include <stdint.h>     // uint64_t
+
+namespace EasyDelegate
+{
+    /**
+     *  @brief A copy of the counters of an AllocationCounter at some point in time.
+     */
+    struct AllocationSnapshot
+    {
+        //! The number of allocations currently live.
+        uint64_t mLiveCount;
+        //! The number of bytes currently live.
+        uint64_t mLiveBytes;
+        //! The highest number of allocations that were live at once.
+        uint64_t mPeakCount;
+        //! The highest number of bytes that were live at once.
+        uint64_t mPeakBytes;
+        //! The number of allocations ever made.
+        uint64_t mAllocationCount;
+
+        //! Standard constructor, zeroing all counters.
+        AllocationSnapshot(void) EASYDELEGATE_NOEXCEPT : mLiveCount(0), mLiveBytes(0), mPeakCount(0), mPeakBytes(0), mAllocationCount(0) { }
+    };
+
+    /**
+     *  @brief Counts the live allocations and bytes attributed to one owner, along with their high-water marks.
+     *  @details Every counter is updated with relaxed atomics, so allocations may be recorded from any thread.
+     */
+    class AllocationCounter
+    {
+        // Public Methods
+        public:
+            //! Standard constructor, zeroing all counters.
+            AllocationCounter(void) EASYDELEGATE_NOEXCEPT : mLiveCount(0), mLiveBytes(0), mPeakCount(0), mPeakBytes(0), mAllocationCount(0) { }
+
+            /**
+             *  @brief Records an allocation.
+             *  @param bytes The size of the allocation.
+             */
+            void recordAllocation(const size_t& bytes) EASYDELEGATE_NOEXCEPT
+            {
+                mAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+                AllocationCounter::raise(mPeakCount, mLiveCount.fetch_add(1, std::memory_order_relaxed) + 1);
+                AllocationCounter::raise(mPeakBytes, mLiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+            }
+
+            /**
+             *  @brief Records a deallocation.
+             *  @param bytes The size of the allocation being released.
+             */
+            void recordDeallocation(const size_t& bytes) EASYDELEGATE_NOEXCEPT
+            {
+                mLiveCount.fetch_sub(1, std::memory_order_relaxed);
+                mLiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+            }
+
+            /**
+             *  @brief Returns a copy of the counters.
+             *  @return An AllocationSnapshot holding the current value of every counter.
+             */
+            AllocationSnapshot getSnapshot(void) const EASYDELEGATE_NOEXCEPT
+            {
+                AllocationSnapshot result;
+                result.mLiveCount = mLiveCount.load(std::memory_order_relaxed);
+                result.mLiveBytes = mLiveBytes.load(std::memory_order_relaxed);
+                result.mPeakCount = mPeakCount.load(std::memory_order_relaxed);
+                result.mPeakBytes = mPeakBytes.load(std::memory_order_relaxed);
+                result.mAllocationCount = mAllocationCount.load(std::memory_order_relaxed);
+
+                return result;
+            }
+
+            //! Lowers the high-water marks to what is currently live.
+            void resetPeaks(void) EASYDELEGATE_NOEXCEPT
+            {
+                mPeakCount.store(mLiveCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                mPeakBytes.store(mLiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+
+        // Private Methods
+        private:
+            //! Raises a high-water mark to the given value if it is lower.
+            static void raise(std::atomic<uint64_t>& peak, const uint64_t& value) EASYDELEGATE_NOEXCEPT
+            {
+                uint64_t current = peak.load(std::memory_order_relaxed);
+                while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed));
+            }
+
+        // Private Members
+        private:
+            //! The number of allocations currently live.
+            std::atomic<uint64_t> mLiveCount;
+            //! The number of bytes currently live.
+            std::atomic<uint64_t> mLiveBytes;
+            //! The highest number of allocations that were live at once.
+            std::atomic<uint64_t> mPeakCount;
+            //! The highest number of bytes that were live at once.
+            std::atomic<uint64_t> mPeakBytes;
+            //! The number of allocations ever made.
+            std::atomic<uint64_t> mAllocationCount;
+    };
+
+    //! The kinds of allocation the library makes, each with its own global AllocationCounter.
+    enum AllocationKind
+    {
+        //! StaticDelegate instances.
+        ALLOCATION_STATIC_DELEGATE,
+        //! MemberDelegate instances.
+        ALLOCATION_MEMBER_DELEGATE,
+        //! FunctionDelegate instances.
+        ALLOCATION_FUNCTION_DELEGATE,
+        //! DeferredStaticCaller instances.
+        ALLOCATION_DEFERRED_STATIC_CALLER,
+        //! DeferredMemberCaller instances.
+        ALLOCATION_DEFERRED_MEMBER_CALLER,
+        //! DeferredBroadcastCaller instances.
+        ALLOCATION_DEFERRED_BROADCAST_CALLER,
+        //! The storage of DelegateSet and DeferredCallQueue containers.
+        ALLOCATION_STORAGE,
+
+        //! The number of allocation kinds.
+        ALLOCATION_KIND_COUNT
+    };
+
+    /**
+     *  @brief The global allocation counters and the hook every accounted allocation goes through.
+     *  @details Delegates and deferred callers route their class level operator new and operator delete
+     *  through allocate and deallocate, and the containers owned by each DelegateSet and DeferredCallQueue
+     *  allocate through an AccountingAllocator bound to the owner's own counter. Allocations made by the
+     *  functions delegates call, or by containers passed in by the caller, are not accounted.
+     */
+    class AllocationAccounting
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Returns the global counter of an allocation kind.
+             *  @param kind The kind of interest.
+             *  @return A reference to the counter of every allocation of that kind.
+             */
+            static AllocationCounter& getCounter(const AllocationKind& kind) EASYDELEGATE_NOEXCEPT
+            {
+                static AllocationCounter counters[ALLOCATION_KIND_COUNT];
+                return counters[kind];
+            }
+
+            /**
+             *  @brief Returns the number of accounted allocations the calling thread has made.
+             *  @return The number of allocations made on this thread through allocate. Comparing this before and
+             *  after an operation tells whether the operation allocated.
+             */
+            static uint64_t getThreadAllocationCount(void) EASYDELEGATE_NOEXCEPT
+            {
+                return AllocationAccounting::getThreadAllocationCountStorage();
+            }
+
+            /**
+             *  @brief Allocates memory and records it.
+             *  @param kind The kind of the allocation.
+             *  @param bytes The size of the allocation.
+             *  @param owner The counter of the object owning the allocation, or NULL.
+             *  @return The allocated memory.
+             *  @throw std::bad_alloc Thrown when the allocation fails.
+             *  @note Never inlined, so that the class level operator new and operator delete of delegates and
+             *  deferred callers remain a matched pair rather than collapsing to the global operator new.
+             */
+            static EASYDELEGATE_NOINLINE void* allocate(const AllocationKind& kind, const size_t& bytes, AllocationCounter* owner=NULL)
+            {
+                void* result = ::operator new(bytes);
+
+                AllocationAccounting::getCounter(kind).recordAllocation(bytes);
+                if (owner)
+                    owner->recordAllocation(bytes);
+
+                ++AllocationAccounting::getThreadAllocationCountStorage();
+                return result;
+            }
+
+            /**
+             *  @brief Records and releases memory returned by allocate.
+             *  @param kind The kind the memory was allocated as.
+             *  @param pointer The memory to release.
+             *  @param bytes The size the memory was allocated with.
+             *  @param owner The counter the memory was allocated against, or NULL.
+             *  @note Never inlined, for the same reason as allocate.
+             */
+            static EASYDELEGATE_NOINLINE void deallocate(const AllocationKind& kind, void* pointer, const size_t& bytes, AllocationCounter* owner=NULL) EASYDELEGATE_NOEXCEPT
+            {
+                if (!pointer)
+                    return;
+
+                AllocationAccounting::getCounter(kind).recordDeallocation(bytes);
+                if (owner)
+                    owner->recordDeallocation(bytes);
+
+                ::operator delete(pointer);
+            }
+
+        // Private Methods
+        private:
+            //! Returns the calling thread's allocation count.
+            static uint64_t& getThreadAllocationCountStorage(void) EASYDELEGATE_NOEXCEPT
+            {
+                static thread_local uint64_t count = 0;
+                return count;
+            }
+    };
+
+    /**
+     *  @brief A standard allocator recording everything it allocates as ALLOCATION_STORAGE, and against the
+     *  counter it is bound to if there is one.
+     *  @details Copies of a container do not inherit the counter of the original, as the original's owner
+     *  may not outlive them.
+     */
+    template <typename type>
+    class AccountingAllocator
+    {
+        // Public Members
+        public:
+            //! The type allocated.
+            typedef type value_type;
+
+            //! Rebinds the allocator to another type, keeping its counter.
+            template <typename otherType>
+            struct rebind
+            {
+                //! The rebound allocator.
+                typedef AccountingAllocator<otherType> other;
+            };
+
+        // Public Methods
+        public:
+            //! Standard constructor, creating an allocator bound to no counter.
+            AccountingAllocator(void) EASYDELEGATE_NOEXCEPT : mCounter(NULL) { }
+
+            /**
+             *  @brief Constructor accepting the counter to record against.
+             *  @param counter The counter of the object owning the allocations, or NULL.
+             */
+            explicit AccountingAllocator(AllocationCounter* counter) EASYDELEGATE_NOEXCEPT : mCounter(counter) { }
+
+            //! Converting constructor, keeping the counter of an allocator of another type.
+            template <typename otherType>
+            AccountingAllocator(const AccountingAllocator<otherType>& other) EASYDELEGATE_NOEXCEPT : mCounter(other.getCounter()) { }
+
+            /**
+             *  @brief Allocates storage for some number of values.
+             *  @param count The number of values.
+             *  @return The allocated storage.
+             */
+            type* allocate(const size_t count)
+            {
+                return static_cast<type*>(AllocationAccounting::allocate(ALLOCATION_STORAGE, count * sizeof(type), mCounter));
+            }
+
+            /**
+             *  @brief Releases storage returned by allocate.
+             *  @param pointer The storage to release.
+             *  @param count The number of values it was allocated for.
+             */
+            void deallocate(type* pointer, const size_t count) EASYDELEGATE_NOEXCEPT
+            {
+                AllocationAccounting::deallocate(ALLOCATION_STORAGE, pointer, count * sizeof(type), mCounter);
+            }
+
+            //! Returns an allocator bound to no counter for copies of a container.
+            AccountingAllocator select_on_container_copy_construction(void) const EASYDELEGATE_NOEXCEPT { return AccountingAllocator(); }
+
+            /**
+             *  @brief Returns the counter this allocator records against.
+             *  @return The counter, or NULL.
+             */
+            EASYDELEGATE_INLINE AllocationCounter* getCounter(void) const EASYDELEGATE_NOEXCEPT { return mCounter; }
+
+        // Private Members
+        private:
+            //! The counter of the object owning the allocations, or NULL.
+            AllocationCounter* mCounter;
+    };
+
+    //! Allocators are interchangeable when they record against the same counter.
+    template <typename leftType, typename rightType>
+    bool operator ==(const AccountingAllocator<leftType>& left, const AccountingAllocator<rightType>& right) EASYDELEGATE_NOEXCEPT
+    {
+        return left.getCounter() == right.getCounter();
+    }
+
+    //! Allocators are interchangeable when they record against the same counter.
+    template <typename leftType, typename rightType>
+    bool operator !=(const AccountingAllocator<leftType>& left, const AccountingAllocator<rightType>& right) EASYDELEGATE_NOEXCEPT
+    {
+        return left.getCounter() != right.getCounter();
+    }
+
+    //! The allocator used by every container the library owns.
+    template <typename type>
+    using StorageAllocator = AccountingAllocator<type>;
+} // End NameSpace EasyDelegate
+#else
+namespace EasyDelegate
+{
+    //! The allocator used by every container the library owns.
+    template <typename type>
+    using StorageAllocator = std::allocator<type>;
+} // End NameSpace EasyDelegate
+#endif // EASYDELEGATE_ALLOCATION_ACCOUNTING
+#endif // _INCLUDE_EASYDELEGATE_ACCOUNTING_HPP_
@@ -0,0 +1,291 @@
+/**
+ *  @file annotateddelegateset.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the AnnotatedDelegateSet type, a DelegateSet that stores a value
+ *  alongside each of its delegates.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_ANNOTATEDDELEGATESET_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_ANNOTATEDDELEGATESET_HPP_
+
+#include <vector>
+
+#include "delegateset.hpp"
+
+namespace EasyDelegate
+{
+    /**
+     *  @brief A DelegateSet that stores an annotation, such as a priority or a channel mask, for each of its
+     *  delegates in a packed vector at the same index as the delegate.
+     *  @details This is the base of the set types that need to know something about each delegate at
+     *  invocation or registration time without touching the delegate itself. It redeclares the removal methods
+     *  of DelegateSet so that the annotations stay in step, and leaves adding delegates to the derived type.
+     *  The DelegateSet is a protected base, so the set cannot be modified through a DelegateSet reference or its
+     *  std::vector. Only its read only and invoke methods are exposed again.
+     */
+    template <typename annotationType, typename returnType, typename... parameters>
+    class AnnotatedDelegateSet : protected DelegateSet<returnType, parameters...>
+    {
+        // Public Methods
+        public:
+            //! Helper typedef referring to the DelegateSet type this set extends.
+            typedef DelegateSet<returnType, parameters...> DelegateSetType;
+            //! Helper typedef referring to the delegate type stored in this set.
+            typedef typename DelegateSetType::StoredDelegateType StoredDelegateType;
+            //! Helper typedef referring to the StaticDelegate type matching this set.
+            typedef StaticDelegate<returnType, parameters...> StaticDelegateType;
+            //! Helper typedef referring to the MemberDelegate type matching this set.
+            template <typename classType>
+            using MemberDelegateType = MemberDelegate<classType, returnType, parameters...>;
+            //! Helper typedef referring to the FunctionDelegate type matching this set.
+            typedef FunctionDelegate<returnType, parameters...> FunctionDelegateType;
+            //! Helper typedef referring to a static function pointer.
+            typedef typename DelegateSetType::StaticDelegateFuncPtr StaticDelegateFuncPtr;
+            //! Helper typedef referring to a member function pointer.
+            template <typename classType>
+            using MemberDelegateFuncPtr = returnType(classType::*)(parameters...);
+            //! Helper typedef referring to the return type of the delegates in this set.
+            typedef returnType ReturnType;
+            //! Helper typedef to an std::vector that is compatible with the return types of delegates stored here.
+            typedef std::vector<returnType> ReturnSetType;
+            //! Helper typedef referring to an iterator over the delegates in this set.
+            typedef typename DelegateSetType::const_iterator const_iterator;
+
+            #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+                //! Helper typedef referring to the deferred caller returned by deferInvoke and deferInvokeSnapshot.
+                typedef typename DelegateSetType::DeferredBroadcastCallerType DeferredBroadcastCallerType;
+            #endif
+
+            //! Helper typedef referring to the range returned by invokeLazy.
+            typedef typename DelegateSetType::LazyInvocationType LazyInvocationType;
+            //! Helper typedef referring to the type stored alongside each delegate.
+            typedef annotationType AnnotationType;
+            //! Helper typedef referring to the container the annotations are stored in.
+            typedef std::vector<annotationType, StorageAllocator<annotationType> > AnnotationStorageType;
+            //! Helper typedef referring to the dispatch table returned by freeze.
+            typedef typename DelegateSetType::FrozenDelegateSetType FrozenDelegateSetType;
+
+            using DelegateSetType::size;
+            using DelegateSetType::empty;
+            using DelegateSetType::begin;
+            using DelegateSetType::end;
+            using DelegateSetType::operator [];
+
+            using DelegateSetType::invoke;
+            using DelegateSetType::invokeInto;
+            using DelegateSetType::invokeIntoBuffer;
+            using DelegateSetType::invokeUntil;
+            using DelegateSetType::invokeUntilHandled;
+            using DelegateSetType::invokeIsolated;
+            using DelegateSetType::tryInvoke;
+            using DelegateSetType::invokeLazy;
+
+            #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+                using DelegateSetType::deferInvoke;
+                using DelegateSetType::deferInvokeSnapshot;
+            #endif
+
+            #ifdef EASYDELEGATE_LISTENER_STATISTICS
+                using DelegateSetType::forEachStatistics;
+                using DelegateSetType::resetStatistics;
+            #endif
+
+            #ifdef EASYDELEGATE_SLOW_LISTENER_DETECTION
+                using DelegateSetType::setSlowListenerThreshold;
+                using DelegateSetType::clearSlowListenerThreshold;
+                using DelegateSetType::getSlowListenerDetector;
+            #endif
+
+            #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                using DelegateSetType::getBroadcastLatency;
+            #endif
+
+            #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                using DelegateSetType::getStorageAllocations;
+            #endif
+
+            //! Removes every delegate from the set without deleting them, as std::vector::clear does.
+            void clear(void) EASYDELEGATE_NOEXCEPT
+            {
+                DelegateSetType::clear();
+                mAnnotations.clear();
+            }
+
+            /**
+             *  @brief Moves every delegate into an immutable dispatch table, as DelegateSet::freeze does, dropping
+             *  their annotations.
+             *  @return A FrozenDelegateSet invoking the delegates in their current order, regardless of annotations.
+             *  @note Ownership of the delegates is given to the returned FrozenDelegateSet.
+             */
+            FrozenDelegateSetType freeze(void)
+            {
+                FrozenDelegateSetType frozen = DelegateSetType::freeze();
+                mAnnotations.clear();
+                return frozen;
+            }
+
+            /**
+             *  @brief Removes all delegates from the set that have the given class member method address
+             *  for its method.
+             *  @param method The class method method poiner to check against.
+             *  @param deleteInstances A boolean representing whether or not all matches should be deleted when removed.
+             *  @param out A vector populated with the removed delegates if deleteInstances is false.
+             *  @warning If deleteInstances=false, then the delegates written to out will have their ownership transferred to whatever made
+             *  the call, so they must be deletated accordingly.
+             */
+            template <typename className>
+            void removeDelegateByMethod(const MemberDelegateFuncPtr<className> method, const bool& deleteInstances=true, std::vector<StoredDelegateType *>* out=NULL)
+            {
+                this->removeMatching([method](StoredDelegateType* current) { return current->callsMethod(method); }, deleteInstances, out);
+            }
+
+            /**
+             *  @brief Removes all delegates from the set that have the given static method address
+             *  for it's method.
+             *  @param methodPointer The static method pointer to check against.
+             *  @param deleteInstances A boolean representing whether or not all matches should be deleted when removed.
+             *  @param out A vector populated with the removed delegates if deleteInstances is false.
+             *  @warning If deleteInstances is false and there is no out specified, you will be leaking memory if there is no other
+             *  delegate sets tracking the removed delegates.
+             */
+            void removeDelegateByMethod(StaticDelegateFuncPtr methodPointer, const bool& deleteInstances=true, std::vector<StoredDelegateType *>* out=NULL)
+            {
+                this->removeMatching([methodPointer](StoredDelegateType* current) { return current->callsMethod(methodPointer); }, deleteInstances, out);
+            }
+
+            /**
+             *  @brief Removes a all MemberDelegate types from the set that have a given 'this' pointer address
+             *  to call against.
+             *  @param thisPtr The address of the object to check against.
+             *  @param deleteInstances A boolean representing whether or not all matches should be deleted when removed.
+             *  @param out A vector populated with the removed delegates if deleteInstances is false.
+             *  @warning If deleteInstances is false and there is no out specified, you will be leaking memory if there is no other
+             *  delegate set tracking the removed delegates.
+             */
+            void removeDelegateByThisPointer(const void* thisPtr, const bool& deleteInstances=true, std::vector<StoredDelegateType *>* out=NULL)
+            {
+                this->removeMatching([thisPtr](StoredDelegateType* current) { return current->mIsMemberDelegate && current->hasThisPointer(thisPtr); },
+                deleteInstances, out);
+            }
+
+            /**
+             *  @brief Removes a given delegate by its address.
+             *  @param instance The delegate pointer to attempt to remove from this set.
+             *  @param deleteInstance A boolean representing whether or not the target delegate should
+             *  be deleted.
+             *  @return A pointer to the delegate that was removed. This is NULL if none were removed or
+             *  if deleteInstance is true.
+             */
+            StoredDelegateType* removeDelegate(StoredDelegateType* instance, const bool& deleteInstance=true)
+            {
+                for (size_t currentIndex = 0; currentIndex < this->size(); ++currentIndex)
+                {
+                    StoredDelegateType* current = this->operator[](currentIndex);
+
+                    if (current == instance)
+                    {
+                        #ifdef EASYDELEGATE_USDT_PROBES
+                            EASYDELEGATE_PROBE2(remove, this, current);
+                        #endif
+
+                        if (deleteInstance)
+                            delete current;
+
+                        StorageType::erase(StorageType::begin() + currentIndex);
+                        mAnnotations.erase(mAnnotations.begin() + currentIndex);
+
+                        if (deleteInstance)
+                            return NULL;
+
+                        return current;
+                    }
+                }
+
+                return NULL;
+            }
+
+        // Protected Methods
+        protected:
+            //! Helper typedef referring to the container the delegates are stored in.
+            typedef typename DelegateSetType::StorageType StorageType;
+
+            //! Standard constructor, recording the annotations against the same allocator as the delegates.
+            AnnotatedDelegateSet(void) : mAnnotations(StorageAllocator<annotationType>(this->get_allocator())) { }
+
+            //! Removes every delegate the predicate accepts, compacting the delegates and annotations in one pass.
+            template <typename predicateType>
+            void removeMatching(predicateType predicate, const bool& deleteInstances, std::vector<StoredDelegateType *>* out)
+            {
+                size_t keptCount = 0;
+
+                for (size_t currentIndex = 0; currentIndex < this->size(); ++currentIndex)
+                {
+                    StoredDelegateType* current = this->operator[](currentIndex);
+
+                    if (predicate(current))
+                    {
+                        #ifdef EASYDELEGATE_USDT_PROBES
+                            EASYDELEGATE_PROBE2(remove, this, current);
+                        #endif
+
+                        if (deleteInstances)
+                            delete current;
+                        else if (out)
+                            out->push_back(current);
+
+                        continue;
+                    }
+
+                    StorageType::operator[](keptCount) = current;
+                    mAnnotations[keptCount] = mAnnotations[currentIndex];
+                    ++keptCount;
+                }
+
+                StorageType::resize(keptCount);
+                mAnnotations.resize(keptCount);
+            }
+
+            /**
+             *  @brief Inserts a delegate and its annotation at the given index.
+             *  @param index The index to insert at, which must not be greater than size().
+             *  @param delegateInstance The delegate instance to insert. Ownership is given to the set.
+             *  @param annotation The annotation to store alongside the delegate.
+             *  @note If either insertion throws, such as std::bad_alloc, neither the delegate nor the annotation
+             *  is added and the delegate remains owned by the caller.
+             */
+            void insertAnnotated(const size_t& index, StoredDelegateType* delegateInstance, const annotationType& annotation)
+            {
+                #ifdef EASYDELEGATE_USDT_PROBES
+                    EASYDELEGATE_PROBE4(add, this, delegateInstance, delegateInstance->getThisPointer(),
+                    reinterpret_cast<const void*>(delegateInstance->getStaticMethodPointer()));
+                #endif
+
+                mAnnotations.insert(mAnnotations.begin() + index, annotation);
+
+                #ifdef EASYDELEGATE_NO_EXCEPTIONS
+                    StorageType::insert(StorageType::begin() + index, delegateInstance);
+                #else
+                    try
+                    {
+                        StorageType::insert(StorageType::begin() + index, delegateInstance);
+                    }
+                    catch (...)
+                    {
+                        mAnnotations.erase(mAnnotations.begin() + index);
+                        throw;
+                    }
+                #endif
+            }
+
+        // Protected Members
+        protected:
+            //! The annotation of each delegate, at the same index as the delegate.
+            AnnotationStorageType mAnnotations;
+    };
+} // End NameSpace EasyDelegate
+#endif // _INCLUDE_EASYDELEGATE_ANNOTATEDDELEGATESET_HPP_
@@ -0,0 +1,210 @@
+/**
+ *  @file channeldelegateset.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the ChannelDelegateSet type, a DelegateSet that only invokes the
+ *  delegates subscribed to the channels an event is raised on.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_CHANNELDELEGATESET_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_CHANNELDELEGATESET_HPP_
+
+#include <stdint.h>         // uint32_t
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>  // _mm_loadu_si128, _mm_and_si128, _mm_cmpeq_epi32, _mm_movemask_ps
+    #define EASYDELEGATE_HAS_SSE2
+#endif
+
+#include "annotateddelegateset.hpp"
+
+namespace EasyDelegate
+{
+    /**
+     *  @brief A set of up to 32 channels that a delegate subscribes to or that an event is raised on.
+     */
+    class ChannelMask
+    {
+        // Public Methods
+        public:
+            //! The integer type the channels are packed into, one bit per channel.
+            typedef uint32_t BitsType;
+
+            //! The number of channels available.
+            static const unsigned int CHANNEL_COUNT = 32;
+
+            /**
+             *  @brief Constructor accepting the packed channel bits.
+             *  @param bits The channels, one bit per channel.
+             */
+            explicit ChannelMask(const BitsType& bits) EASYDELEGATE_NOEXCEPT : mBits(bits) { }
+
+            /**
+             *  @brief Returns a mask of a single channel.
+             *  @param index The index of the channel, less than CHANNEL_COUNT.
+             *  @return A mask containing only the given channel.
+             */
+            static EASYDELEGATE_INLINE ChannelMask channel(const unsigned int& index) EASYDELEGATE_NOEXCEPT
+            {
+                return ChannelMask(static_cast<BitsType>(1) << index);
+            }
+
+            //! Returns a mask containing every channel.
+            static EASYDELEGATE_INLINE ChannelMask all(void) EASYDELEGATE_NOEXCEPT { return ChannelMask(~static_cast<BitsType>(0)); }
+
+            //! Returns the packed channel bits.
+            EASYDELEGATE_INLINE BitsType getBits(void) const EASYDELEGATE_NOEXCEPT { return mBits; }
+
+            //! Returns whether or not this mask shares any channel with another.
+            EASYDELEGATE_INLINE bool intersects(const ChannelMask& other) const EASYDELEGATE_NOEXCEPT { return (mBits & other.mBits) != 0; }
+
+            //! Returns the union of this mask and another.
+            EASYDELEGATE_INLINE ChannelMask operator |(const ChannelMask& other) const EASYDELEGATE_NOEXCEPT { return ChannelMask(mBits | other.mBits); }
+
+            //! Returns whether or not this mask contains the same channels as another.
+            EASYDELEGATE_INLINE bool operator ==(const ChannelMask& other) const EASYDELEGATE_NOEXCEPT { return mBits == other.mBits; }
+
+        // Private Members
+        private:
+            //! The channels, one bit per channel.
+            BitsType mBits;
+    };
+
+    /**
+     *  @brief A DelegateSet whose delegates subscribe to channels, so that an event raised on some channels
+     *  invokes only the delegates subscribed to at least one of them.
+     *  @details The channel masks are packed in a vector alongside the delegates. Invoking the set with a
+     *  ChannelMask scans the masks, four at a time with SSE2 where it is available, and only calls the
+     *  delegates that match, so unsubscribed delegates cost a few bits of a vector compare rather than a call.
+     *  Delegates are invoked in the order they were added. The invoke methods of DelegateSet remain available
+     *  and invoke every delegate regardless of its channels.
+     */
+    template <typename returnType, typename... parameters>
+    class ChannelDelegateSet : public AnnotatedDelegateSet<ChannelMask::BitsType, returnType, parameters...>
+    {
+        // Public Methods
+        public:
+            //! Helper typedef referring to the DelegateSet type this set extends.
+            typedef DelegateSet<returnType, parameters...> DelegateSetType;
+            //! Helper typedef referring to the delegate type stored in this set.
+            typedef typename DelegateSetType::StoredDelegateType StoredDelegateType;
+
+            using DelegateSetType::invoke;
+
+            /**
+             *  @brief Adds a delegate instance to the end of the set, subscribed to the given channels.
+             *  @param delegateInstance The delegate instance to add to the set.
+             *  @param channels The channels the delegate is invoked for.
+             *  @warning Ownership of the delegate will be given to the set, therefore the
+             *  given delegate should not be deleted manually.
+             */
+            EASYDELEGATE_INLINE void add(StoredDelegateType* delegateInstance, const ChannelMask& channels)
+            {
+                this->insertAnnotated(this->size(), delegateInstance, channels.getBits());
+            }
+
+            /**
+             *  @brief Adds a delegate instance to the end of the set, subscribed to every channel.
+             *  @param delegateInstance The delegate instance to add to the set.
+             *  @warning Ownership of the delegate will be given to the set, therefore the
+             *  given delegate should not be deleted manually.
+             */
+            EASYDELEGATE_INLINE void operator +=(StoredDelegateType* delegateInstance)
+            {
+                this->add(delegateInstance, ChannelMask::all());
+            }
+
+            /**
+             *  @brief Returns the channels the delegate at the given index is subscribed to.
+             *  @param index The index of the delegate.
+             *  @return The channels the delegate was added with.
+             */
+            EASYDELEGATE_INLINE ChannelMask getChannels(const size_t& index) const { return ChannelMask(this->mAnnotations[index]); }
+
+            /**
+             *  @brief Invoke every delegate subscribed to any of the given channels, ignoring return values.
+             *  @param channels The channels the event is raised on.
+             *  @param params All other arguments that will be used as parameters to each delegate.
+             *  @throw InvalidMethodPointerException Thrown when assertions are disabled and either
+             *  a stored MemberDelegate or StaticDelegate type have a NULL function to call.
+             *  @throw InvalidThisPointerException Thrown when assertions are disabled and a stored
+             *  MemberDelegate is attempting to call against a NULL this pointer.
+             *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls.
+             *  @note The call will not throw an exception in any of the DelegateException cases but rather
+             *  assert if assertions are enabled.
+             *  @note If this throws an exception, the invocation of the set halts.
+             */
+            EASYDELEGATE_INLINE void invoke(const ChannelMask& channels, parameters... params) const
+            {
+                const BroadcastInstrumentation instrumentation("ChannelDelegateSet::invoke", this);
+
+                this->forEachSubscribed(channels, [&](StoredDelegateType* delegateInstance) {
+                    DelegateSetType::invokeDelegate(this, delegateInstance, params...);
+                });
+            }
+
+            /**
+             *  @brief Invoke every delegate subscribed to any of the given channels, storing return values in out.
+             *  @param out The std::vector that all return values will be sequentially written to.
+             *  @param channels The channels the event is raised on.
+             *  @param params All other arguments that will be used as parameters to each delegate.
+             *  @throw InvalidMethodPointerException Thrown when assertions are disabled and either
+             *  a stored MemberDelegate or StaticDelegate type have a NULL function to call.
+             *  @throw InvalidThisPointerException Thrown when assertions are disabled and a stored
+             *  MemberDelegate is attempting to call against a NULL this pointer.
+             *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls.
+             *  @note The call will not throw an exception in any of the DelegateException cases but rather
+             *  assert if assertions are enabled.
+             *  @note If this throws an exception, the invocation of the set halts.
+             */
+            EASYDELEGATE_INLINE void invoke(std::vector<returnType>& out, const ChannelMask& channels, parameters... params) const
+            {
+                const BroadcastInstrumentation instrumentation("ChannelDelegateSet::invoke", this);
+
+                this->forEachSubscribed(channels, [&](StoredDelegateType* delegateInstance) {
+                    out.push_back(DelegateSetType::invokeDelegate(this, delegateInstance, params...));
+                });
+            }
+
+        // Private Methods
+        private:
+            //! Calls the callback with every delegate subscribed to any of the given channels, in order.
+            template <typename callbackType>
+            EASYDELEGATE_INLINE void forEachSubscribed(const ChannelMask& channels, callbackType callback) const
+            {
+                const ChannelMask::BitsType bits = channels.getBits();
+                const ChannelMask::BitsType* masks = this->mAnnotations.data();
+                const size_t count = this->mAnnotations.size();
+                size_t index = 0;
+
+                #ifdef EASYDELEGATE_HAS_SSE2
+                    const __m128i query = _mm_set1_epi32(static_cast<int>(bits));
+                    const __m128i zero = _mm_setzero_si128();
+
+                    for (; index + 4 <= count; index += 4)
+                    {
+                        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks + index));
+                        const __m128i unsubscribed = _mm_cmpeq_epi32(_mm_and_si128(block, query), zero);
+                        const int matches = ~_mm_movemask_ps(_mm_castsi128_ps(unsubscribed)) & 0xF;
+
+                        if (!matches)
+                            continue;
+
+                        for (unsigned int lane = 0; lane < 4; ++lane)
+                            if (matches & (1 << lane))
+                                callback(this->operator[](index + lane));
+                    }
+                #endif
+
+                for (; index < count; ++index)
+                    if (masks[index] & bits)
+                        callback(this->operator[](index));
+            }
+    };
+} // End NameSpace EasyDelegate
+#endif // _INCLUDE_EASYDELEGATE_CHANNELDELEGATESET_HPP_
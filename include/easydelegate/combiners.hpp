@@ -0,0 +1,272 @@
+/**
+ *  @file combiners.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the combiners that DelegateSet::invoke can fold return values into.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_COMBINERS_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_COMBINERS_HPP_
+
+namespace EasyDelegate
+{
+    /*
+     *  A combiner is any type with a ResultType typedef, a combine method accepting each return value in
+     *  invocation order and a getResult method returning the folded result. Combiners are copied into
+     *  DelegateSet::invoke, so they should be cheap to copy.
+     */
+
+    /**
+     *  @brief Combiner adding every return value together.
+     *  @details The result is the initial value when no delegates were invoked.
+     */
+    template <typename valueType>
+    class SumCombiner
+    {
+        // Public Methods
+        public:
+            //! The type of the folded result.
+            typedef valueType ResultType;
+
+            /**
+             *  @brief Constructor accepting the value to start adding from.
+             *  @param initial The value the return values are added to.
+             */
+            SumCombiner(const valueType& initial=valueType()) : mResult(initial) { }
+
+            //! Adds a return value to the result.
+            EASYDELEGATE_INLINE void combine(const valueType& value) { mResult += value; }
+
+            //! Returns the sum.
+            EASYDELEGATE_INLINE const ResultType& getResult(void) const EASYDELEGATE_NOEXCEPT { return mResult; }
+
+        // Private Members
+        private:
+            //! The sum so far.
+            ResultType mResult;
+    };
+
+    /**
+     *  @brief Combiner keeping the smallest return value, as compared with operator <.
+     *  @details The result is the empty value when no delegates were invoked.
+     */
+    template <typename valueType>
+    class MinimumCombiner
+    {
+        // Public Methods
+        public:
+            //! The type of the folded result.
+            typedef valueType ResultType;
+
+            /**
+             *  @brief Constructor accepting the result when no delegates are invoked.
+             *  @param empty The result when no delegates are invoked.
+             */
+            MinimumCombiner(const valueType& empty=valueType()) : mResult(empty), mHasResult(false) { }
+
+            //! Keeps a return value if it is the smallest so far.
+            EASYDELEGATE_INLINE void combine(const valueType& value)
+            {
+                if (!mHasResult || value < mResult)
+                    mResult = value;
+
+                mHasResult = true;
+            }
+
+            //! Returns the smallest return value.
+            EASYDELEGATE_INLINE const ResultType& getResult(void) const EASYDELEGATE_NOEXCEPT { return mResult; }
+
+            //! Returns whether or not any value was combined.
+            EASYDELEGATE_INLINE bool hasResult(void) const EASYDELEGATE_NOEXCEPT { return mHasResult; }
+
+        // Private Members
+        private:
+            //! The smallest return value so far.
+            ResultType mResult;
+            //! Whether or not any value was combined.
+            bool mHasResult;
+    };
+
+    /**
+     *  @brief Combiner keeping the largest return value, as compared with operator <.
+     *  @details The result is the empty value when no delegates were invoked.
+     */
+    template <typename valueType>
+    class MaximumCombiner
+    {
+        // Public Methods
+        public:
+            //! The type of the folded result.
+            typedef valueType ResultType;
+
+            /**
+             *  @brief Constructor accepting the result when no delegates are invoked.
+             *  @param empty The result when no delegates are invoked.
+             */
+            MaximumCombiner(const valueType& empty=valueType()) : mResult(empty), mHasResult(false) { }
+
+            //! Keeps a return value if it is the largest so far.
+            EASYDELEGATE_INLINE void combine(const valueType& value)
+            {
+                if (!mHasResult || mResult < value)
+                    mResult = value;
+
+                mHasResult = true;
+            }
+
+            //! Returns the largest return value.
+            EASYDELEGATE_INLINE const ResultType& getResult(void) const EASYDELEGATE_NOEXCEPT { return mResult; }
+
+            //! Returns whether or not any value was combined.
+            EASYDELEGATE_INLINE bool hasResult(void) const EASYDELEGATE_NOEXCEPT { return mHasResult; }
+
+        // Private Members
+        private:
+            //! The largest return value so far.
+            ResultType mResult;
+            //! Whether or not any value was combined.
+            bool mHasResult;
+    };
+
+    /**
+     *  @brief Combiner reporting whether every return value converted to true.
+     *  @details The result is true when no delegates were invoked. Every delegate is still invoked after
+     *  one returns false.
+     */
+    class AllCombiner
+    {
+        // Public Methods
+        public:
+            //! The type of the folded result.
+            typedef bool ResultType;
+
+            //! Standard constructor.
+            AllCombiner(void) EASYDELEGATE_NOEXCEPT : mResult(true) { }
+
+            //! Folds a return value into the result.
+            template <typename valueType>
+            EASYDELEGATE_INLINE void combine(const valueType& value) { mResult = mResult && static_cast<bool>(value); }
+
+            //! Returns whether or not every return value converted to true.
+            EASYDELEGATE_INLINE bool getResult(void) const EASYDELEGATE_NOEXCEPT { return mResult; }
+
+        // Private Members
+        private:
+            //! Whether or not every return value so far converted to true.
+            bool mResult;
+    };
+
+    /**
+     *  @brief Combiner reporting whether any return value converted to true.
+     *  @details The result is false when no delegates were invoked. Every delegate is still invoked after
+     *  one returns true.
+     */
+    class AnyCombiner
+    {
+        // Public Methods
+        public:
+            //! The type of the folded result.
+            typedef bool ResultType;
+
+            //! Standard constructor.
+            AnyCombiner(void) EASYDELEGATE_NOEXCEPT : mResult(false) { }
+
+            //! Folds a return value into the result.
+            template <typename valueType>
+            EASYDELEGATE_INLINE void combine(const valueType& value) { mResult = mResult || static_cast<bool>(value); }
+
+            //! Returns whether or not any return value converted to true.
+            EASYDELEGATE_INLINE bool getResult(void) const EASYDELEGATE_NOEXCEPT { return mResult; }
+
+        // Private Members
+        private:
+            //! Whether or not any return value so far converted to true.
+            bool mResult;
+    };
+
+    /**
+     *  @brief Combiner keeping the return value of the first delegate invoked.
+     *  @details The result is the empty value when no delegates were invoked.
+     */
+    template <typename valueType>
+    class FirstCombiner
+    {
+        // Public Methods
+        public:
+            //! The type of the folded result.
+            typedef valueType ResultType;
+
+            /**
+             *  @brief Constructor accepting the result when no delegates are invoked.
+             *  @param empty The result when no delegates are invoked.
+             */
+            FirstCombiner(const valueType& empty=valueType()) : mResult(empty), mHasResult(false) { }
+
+            //! Keeps a return value if it is the first.
+            EASYDELEGATE_INLINE void combine(const valueType& value)
+            {
+                if (mHasResult)
+                    return;
+
+                mResult = value;
+                mHasResult = true;
+            }
+
+            //! Returns the first return value.
+            EASYDELEGATE_INLINE const ResultType& getResult(void) const EASYDELEGATE_NOEXCEPT { return mResult; }
+
+            //! Returns whether or not any value was combined.
+            EASYDELEGATE_INLINE bool hasResult(void) const EASYDELEGATE_NOEXCEPT { return mHasResult; }
+
+        // Private Members
+        private:
+            //! The first return value.
+            ResultType mResult;
+            //! Whether or not any value was combined.
+            bool mHasResult;
+    };
+
+    /**
+     *  @brief Combiner keeping the return value of the last delegate invoked.
+     *  @details The result is the empty value when no delegates were invoked.
+     */
+    template <typename valueType>
+    class LastCombiner
+    {
+        // Public Methods
+        public:
+            //! The type of the folded result.
+            typedef valueType ResultType;
+
+            /**
+             *  @brief Constructor accepting the result when no delegates are invoked.
+             *  @param empty The result when no delegates are invoked.
+             */
+            LastCombiner(const valueType& empty=valueType()) : mResult(empty), mHasResult(false) { }
+
+            //! Keeps a return value, replacing the previous one.
+            EASYDELEGATE_INLINE void combine(const valueType& value)
+            {
+                mResult = value;
+                mHasResult = true;
+            }
+
+            //! Returns the last return value.
+            EASYDELEGATE_INLINE const ResultType& getResult(void) const EASYDELEGATE_NOEXCEPT { return mResult; }
+
+            //! Returns whether or not any value was combined.
+            EASYDELEGATE_INLINE bool hasResult(void) const EASYDELEGATE_NOEXCEPT { return mHasResult; }
+
+        // Private Members
+        private:
+            //! The last return value.
+            ResultType mResult;
+            //! Whether or not any value was combined.
+            bool mHasResult;
+    };
+} // End NameSpace EasyDelegate
+#endif // _INCLUDE_EASYDELEGATE_COMBINERS_HPP_
@@ -18,6 +18,11 @@
 #include <assert.h> // assert(expr)
 #include <tuple>    // std::tuple
 
+#include "exceptions.hpp"
+#include "tracing.hpp"
+#include "probes.hpp"
+#include "accounting.hpp"
+
 namespace EasyDelegate
 {
     /**
@@ -44,10 +49,67 @@ namespace EasyDelegate
              */
 			EASYDELEGATE_INLINE virtual bool hasThisPointer(const void* thisPointer) const EASYDELEGATE_NOEXCEPT{ return false; }
 
+            /**
+             *  @brief Returns the this pointer this deferred caller calls against.
+             *  @return A pointer to the object this deferred caller calls a member function against.
+             *  @note Always returns NULL for static deferred caller types because they do not use a this pointer.
+             */
+            EASYDELEGATE_INLINE virtual const void* getThisPointer(void) const EASYDELEGATE_NOEXCEPT { return NULL; }
+
+            /**
+             *  @brief Returns whether or not this deferred caller calls the same method as the given deferred
+             *  caller, whatever its type.
+             *  @param other A pointer to the deferred caller to check against.
+             *  @return A boolean representing whether or not both deferred callers call the same method.
+             *  @note Always returns false unless overridden, as the method called is unknown at this level.
+             */
+            EASYDELEGATE_INLINE virtual bool hasSameMethodAs(const IDeferredCaller* other) const EASYDELEGATE_NOEXCEPT { return false; }
+
+            /**
+             *  @brief Returns a hash of the method this deferred caller calls.
+             *  @return A hash that is identical for any two deferred callers where hasSameMethodAs returns true. The
+             *  hash incorporates the deferred caller type, so callers of different types are unlikely to collide.
+             *  @note Always returns 0 unless overridden, as the method called is unknown at this level.
+             */
+            EASYDELEGATE_INLINE virtual size_t getMethodHash(void) const EASYDELEGATE_NOEXCEPT { return 0; }
+
+            /**
+             *  @brief Returns an address unique to the concrete type of this deferred caller, allowing deferred
+             *  callers of unknown type to be compared without RTTI.
+             *  @return The address identifying the deferred caller type.
+             *  @note Always returns NULL unless overridden.
+             */
+            EASYDELEGATE_INLINE virtual const void* getTypeTag(void) const EASYDELEGATE_NOEXCEPT { return NULL; }
+
             /**
              *  @brief Destructor. Currently mostly used to resolve compiler warnings about non-virtual destructors.
              */
             virtual ~IDeferredCaller() { }
+
+            #ifdef EASYDELEGATE_TRACING
+                /**
+                 *  @brief Returns the ID of the trace flow linking the creation of this deferred caller to its dispatch.
+                 *  @return The flow ID.
+                 */
+                EASYDELEGATE_INLINE uint64_t getTraceFlowID(void) const EASYDELEGATE_NOEXCEPT { return mTraceFlowID; }
+            #endif
+
+        // Protected Methods
+        protected:
+            #ifdef EASYDELEGATE_TRACING
+                //! Standard constructor, recording the start of the trace flow to this deferred caller's dispatch.
+                IDeferredCaller(void) : mTraceFlowID(Tracer::getInstance().allocateFlowID())
+                {
+                    TraceScope scope("IDeferredCaller::IDeferredCaller", this, 's', mTraceFlowID);
+                }
+            #endif
+
+        #ifdef EASYDELEGATE_TRACING
+            // Private Members
+            private:
+                //! The ID of the trace flow linking the creation of this deferred caller to its dispatch.
+                uint64_t mTraceFlowID;
+        #endif
     };
 
     /**
@@ -92,7 +154,26 @@ namespace EasyDelegate
              *  @param params The parameter list to use when later dispatching this DeferredStaticCaller.
              */
             DeferredStaticCaller(const StaticDelegateMethodPointer methodPointer, parameters... params) :
-            mParameters(params...), mMethodPointer(methodPointer) { }
+            mParameters(params...), mMethodPointer(methodPointer)
+            {
+                EASYDELEGATE_CHECK_CONSTRUCTION(methodPointer, InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
+            }
+
+            #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                /**
+                 *  @brief Allocates a DeferredStaticCaller, recording it as ALLOCATION_DEFERRED_STATIC_CALLER.
+                 *  @param size The size of the DeferredStaticCaller.
+                 *  @return The allocated memory.
+                 */
+                static void* operator new(size_t size) { return AllocationAccounting::allocate(ALLOCATION_DEFERRED_STATIC_CALLER, size); }
+
+                /**
+                 *  @brief Releases a DeferredStaticCaller allocated by operator new.
+                 *  @param pointer The memory to release.
+                 *  @param size The size of the DeferredStaticCaller.
+                 */
+                static void operator delete(void* pointer, size_t size) EASYDELEGATE_NOEXCEPT { AllocationAccounting::deallocate(ALLOCATION_DEFERRED_STATIC_CALLER, pointer, size); }
+            #endif
 
             /**
              *  @brief Dispatches the DeferredStaticCaller.
@@ -105,20 +186,38 @@ namespace EasyDelegate
             EASYDELEGATE_INLINE returnType dispatch(void) const
             {
                 assert(mMethodPointer);
-
-                if (!mMethodPointer)
-                    throw InvalidMethodPointerException();
+                EASYDELEGATE_CHECK_CALL(mMethodPointer, InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
 
                 return performCachedCall(typename gens<sizeof...(parameters)>::type());
             }
 
+            /**
+             *  @brief Returns the failure dispatching this DeferredStaticCaller would report, without dispatching it.
+             *  @return DELEGATE_ERROR_INVALID_METHOD_POINTER if the static method is NULL, otherwise DELEGATE_ERROR_NONE.
+             */
+            DelegateError getCallError(void) const EASYDELEGATE_NOEXCEPT
+            {
+                return mMethodPointer ? DELEGATE_ERROR_NONE : DELEGATE_ERROR_INVALID_METHOD_POINTER;
+            }
+
             /**
              *  @brief Dispatches the DeferredStaticCaller, ignoring the return value.
              *  @details This behaves exactly as the dispatch method above except it does not
              *  care about the return of the called function. This method is also callable on
              *  the IDeferredCaller type, unlike the normal dispatch method.
              */
-            EASYDELEGATE_INLINE void genericDispatch(void) const { dispatch(); }
+            EASYDELEGATE_INLINE void genericDispatch(void) const
+            {
+                #ifdef EASYDELEGATE_USDT_PROBES
+                    DispatchProbe probe(this);
+                #endif
+
+                #ifdef EASYDELEGATE_TRACING
+                    TraceScope scope("IDeferredCaller::genericDispatch", this, 'f', this->getTraceFlowID());
+                #endif
+
+                dispatch();
+            }
 
             /**
              *  @brief Returns whether or not this DeferredStaticCaller calls the given static method
@@ -177,6 +276,30 @@ namespace EasyDelegate
             template <typename otherReturn, typename... otherParams>
 			EASYDELEGATE_INLINE bool hasSameMethodAs(const DeferredStaticCaller<otherReturn, otherParams...>* other) const EASYDELEGATE_NOEXCEPT { return false; }
 
+            /**
+             *  @brief Returns whether or not this DeferredStaticCaller calls the same method as the given deferred
+             *  caller of unknown type.
+             *  @param other A pointer to the IDeferredCaller to check against.
+             *  @return A boolean representing whether or not the given deferred caller is a DeferredStaticCaller of
+             *  the same signature calling the same method.
+             */
+            EASYDELEGATE_INLINE bool hasSameMethodAs(const IDeferredCaller* other) const EASYDELEGATE_NOEXCEPT
+            {
+                return other->getTypeTag() == this->getTypeTag() && this->hasSameMethodAs(static_cast<const DeferredStaticCaller<returnType, parameters...>*>(other));
+            }
+
+            /**
+             *  @brief Returns a hash of the static method this DeferredStaticCaller calls.
+             *  @return A hash of the static method pointer.
+             */
+            EASYDELEGATE_INLINE size_t getMethodHash(void) const EASYDELEGATE_NOEXCEPT { return hashMethodPointer(this->getTypeTag(), mMethodPointer); }
+
+            /**
+             *  @brief Returns the address identifying the DeferredStaticCaller type.
+             *  @return The address of the TypeTag of this deferred caller type.
+             */
+            EASYDELEGATE_INLINE const void* getTypeTag(void) const EASYDELEGATE_NOEXCEPT { return &TypeTag<DeferredStaticCaller<returnType, parameters...>>::sTag; }
+
             /**
              *  @brief Returns whether or not this DeferredStaticCaller calls against the given this pointer.
              *  @param thisPointer A pointer referring to the object of interest.
@@ -241,7 +364,27 @@ namespace EasyDelegate
              *  behavior and/or segfault upon invocation in that case.
              */
             DeferredMemberCaller(const MemberDelegateMethodPointer methodPointer, classType* thisPointer, parameters... params) :
-            mThisPointer(thisPointer), mParameters(params...), mMethodPointer(methodPointer) { }
+            mThisPointer(thisPointer), mParameters(params...), mMethodPointer(methodPointer)
+            {
+                EASYDELEGATE_CHECK_CONSTRUCTION(thisPointer, InvalidThisPointerException, DELEGATE_ERROR_INVALID_THIS_POINTER);
+                EASYDELEGATE_CHECK_CONSTRUCTION(methodPointer, InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
+            }
+
+            #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                /**
+                 *  @brief Allocates a DeferredMemberCaller, recording it as ALLOCATION_DEFERRED_MEMBER_CALLER.
+                 *  @param size The size of the DeferredMemberCaller.
+                 *  @return The allocated memory.
+                 */
+                static void* operator new(size_t size) { return AllocationAccounting::allocate(ALLOCATION_DEFERRED_MEMBER_CALLER, size); }
+
+                /**
+                 *  @brief Releases a DeferredMemberCaller allocated by operator new.
+                 *  @param pointer The memory to release.
+                 *  @param size The size of the DeferredMemberCaller.
+                 */
+                static void operator delete(void* pointer, size_t size) EASYDELEGATE_NOEXCEPT { AllocationAccounting::deallocate(ALLOCATION_DEFERRED_MEMBER_CALLER, pointer, size); }
+            #endif
 
             /**
              *  @brief Dispatches the DeferredMemberCaller.
@@ -255,14 +398,23 @@ namespace EasyDelegate
             {
                 assert(mThisPointer);
                 assert(mMethodPointer);
+                EASYDELEGATE_CHECK_CALL(mThisPointer, InvalidThisPointerException, DELEGATE_ERROR_INVALID_THIS_POINTER);
+                EASYDELEGATE_CHECK_CALL(mMethodPointer, InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
 
-                if (!mThisPointer)
-                    throw InvalidThisPointerException();
+                return performCachedCall(typename gens<sizeof...(parameters)>::type());
+            }
 
-                if (!mMethodPointer)
-                    throw InvalidMethodPointerException();
+            /**
+             *  @brief Returns the failure dispatching this DeferredMemberCaller would report, without dispatching it.
+             *  @return DELEGATE_ERROR_INVALID_THIS_POINTER if the this pointer is NULL, DELEGATE_ERROR_INVALID_METHOD_POINTER
+             *  if the class member method is NULL, otherwise DELEGATE_ERROR_NONE.
+             */
+            DelegateError getCallError(void) const EASYDELEGATE_NOEXCEPT
+            {
+                if (!mThisPointer)
+                    return DELEGATE_ERROR_INVALID_THIS_POINTER;
 
-                return performCachedCall(typename gens<sizeof...(parameters)>::type());
+                return mMethodPointer ? DELEGATE_ERROR_NONE : DELEGATE_ERROR_INVALID_METHOD_POINTER;
             }
 
             /**
@@ -271,7 +423,18 @@ namespace EasyDelegate
              *  care about the return of the called function. This method is also callable on
              *  the IDeferredCaller type, unlike the normal dispatch method.
              */
-            EASYDELEGATE_INLINE void genericDispatch(void) const { dispatch(); }
+            EASYDELEGATE_INLINE void genericDispatch(void) const
+            {
+                #ifdef EASYDELEGATE_USDT_PROBES
+                    DispatchProbe probe(this);
+                #endif
+
+                #ifdef EASYDELEGATE_TRACING
+                    TraceScope scope("IDeferredCaller::genericDispatch", this, 'f', this->getTraceFlowID());
+                #endif
+
+                dispatch();
+            }
 
             /**
              *  @brief Returns whether or not this DeferredMemberCaller calls the given class member method.
@@ -331,6 +494,30 @@ namespace EasyDelegate
             template <typename otherReturn, typename... otherParams>
 			EASYDELEGATE_INLINE bool hasSameMethodAs(const DeferredStaticCaller<otherReturn, otherParams...>* other) const EASYDELEGATE_NOEXCEPT { return false; }
 
+            /**
+             *  @brief Returns whether or not this DeferredMemberCaller calls the same method as the given deferred
+             *  caller of unknown type.
+             *  @param other A pointer to the IDeferredCaller to check against.
+             *  @return A boolean representing whether or not the given deferred caller is a DeferredMemberCaller of
+             *  the same class and signature calling the same method.
+             */
+            EASYDELEGATE_INLINE bool hasSameMethodAs(const IDeferredCaller* other) const EASYDELEGATE_NOEXCEPT
+            {
+                return other->getTypeTag() == this->getTypeTag() && this->hasSameMethodAs(static_cast<const DeferredMemberCaller<classType, returnType, parameters...>*>(other));
+            }
+
+            /**
+             *  @brief Returns a hash of the class member method this DeferredMemberCaller calls.
+             *  @return A hash of the class member method pointer.
+             */
+            EASYDELEGATE_INLINE size_t getMethodHash(void) const EASYDELEGATE_NOEXCEPT { return hashMethodPointer(this->getTypeTag(), mMethodPointer); }
+
+            /**
+             *  @brief Returns the address identifying the DeferredMemberCaller type.
+             *  @return The address of the TypeTag of this deferred caller type.
+             */
+            EASYDELEGATE_INLINE const void* getTypeTag(void) const EASYDELEGATE_NOEXCEPT { return &TypeTag<DeferredMemberCaller<classType, returnType, parameters...>>::sTag; }
+
             /**
              *  @brief Returns whether or not this DeferredMemberCaller calls against the same this pointer as another.
              *  @return A boolean representing whether or not this DeferredMemberCaller calls against the same this
@@ -339,6 +526,22 @@ namespace EasyDelegate
             template <typename otherClass, typename otherReturn, typename... otherParams>
 			EASYDELEGATE_INLINE bool hasSameThisPointerAs(const DeferredMemberCaller<otherClass, otherReturn, otherParams...>* other) const EASYDELEGATE_NOEXCEPT { return reinterpret_cast<void*>(mThisPointer) == reinterpret_cast<void*>(other->mThisPointer); }
 
+            /**
+             *  @brief Changes the this pointer this DeferredMemberCaller calls against.
+             *  @param thisPointer A pointer to the object instance to be considered this during invocation.
+             *  @throw EasyDelegate::InvalidThisPointerException Thrown with EASYDELEGATE_UNCHECKED defined when
+             *  the this pointer is NULL, in which case the this pointer is left unchanged.
+             */
+            void setThisPointer(classType* thisPointer)
+            {
+                EASYDELEGATE_CHECK_CONSTRUCTION(thisPointer, InvalidThisPointerException, DELEGATE_ERROR_INVALID_THIS_POINTER);
+                mThisPointer = thisPointer;
+            }
+
+            //! Every DeferredMemberCaller may read the this pointer of another in hasSameThisPointerAs.
+            template <typename otherClass, typename otherReturn, typename... otherParams>
+            friend class DeferredMemberCaller;
+
             /**
              *  @brief Returns whether or not this DeferredMemberCaller calls against the same this pointer of the
              *  DeferredStaticCaller.
@@ -357,9 +560,24 @@ namespace EasyDelegate
              */
 			EASYDELEGATE_INLINE bool hasThisPointer(const void* thisPointer) const EASYDELEGATE_NOEXCEPT { return reinterpret_cast<const void*>(mThisPointer) == reinterpret_cast<const void*>(thisPointer); }
 
-        // Public Members
-        public:
-            //! A pointer to the this object to invoke against.
+            /**
+             *  @brief Returns the this pointer this DeferredMemberCaller calls against.
+             *  @return A pointer to the object this DeferredMemberCaller calls its class member method against.
+             */
+            EASYDELEGATE_INLINE const void* getThisPointer(void) const EASYDELEGATE_NOEXCEPT { return reinterpret_cast<const void*>(mThisPointer); }
+
+        #ifdef EASYDELEGATE_UNCHECKED
+            // Private Members
+            private:
+        #else
+            // Public Members
+            public:
+        #endif
+            /**
+             *  @brief A pointer to the this object to invoke against.
+             *  @note Private with EASYDELEGATE_UNCHECKED defined, as it is then never checked when invoked and can
+             *  only be changed through setThisPointer.
+             */
             classType* mThisPointer;
 
         // Private Methods
@@ -368,11 +586,6 @@ namespace EasyDelegate
             template<int ...S>
             EASYDELEGATE_INLINE EASYDELEGATE_CONSTEXPR returnType performCachedCall(seq<S...>) const
             {
-                assert(mThisPointer);
-
-                if (!mThisPointer)
-                    throw InvalidThisPointerException();
-
                 return (mThisPointer->*mMethodPointer)(std::get<S>(mParameters) ...);
             }
 
@@ -0,0 +1,635 @@
+/**
+ *  @file deferredjournal.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the DeferredCallJournal type, an append-only memory mapped
+ *  journal of deferred calls that can be replayed through registered delegates.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(EASYDELEGATE_NO_DEFERRED_CALLING) && ISCPP11 && (defined(__unix__) || defined(__APPLE__))
+
+#ifndef _INCLUDE_EASYDELEGATE_DEFERREDJOURNAL_HPP_
+#define _INCLUDE_EASYDELEGATE_DEFERREDJOURNAL_HPP_
+
+#include <assert.h>     // assert(expr)
+#include <stdint.h>     // uint32_t, uint64_t
+#include <string.h>     // memcpy
+#include <fcntl.h>      // open
+#include <unistd.h>     // close, ftruncate, sysconf
+#include <sys/mman.h>   // mmap, msync, munmap
+#include <sys/stat.h>   // fstat
+#include <tuple>        // std::tuple
+#include <type_traits>  // std::decay, std::is_trivially_copyable
+#include <unordered_map>
+
+#include "types.hpp"
+#include "delegates.hpp"
+#include "exceptions.hpp"
+
+namespace EasyDelegate
+{
+    /**
+     *  @brief An append-only journal of deferred calls stored in a memory mapped file.
+     *  @details Each record in the journal stores a registered method ID along with the
+     *  arguments of the call and a checksum of both. Arguments are copied directly from the caller
+     *  into the mapping. Once every configured number of records, appending also starts an
+     *  asynchronous msync of the records written since the last one, which does not wait for the disk.
+     *  DeferredCallJournal::sync writes the records back synchronously and only then publishes the
+     *  new end in the file header.
+     *
+     *  On restart, or in an offline tool, the same method IDs are registered against delegates
+     *  and DeferredCallJournal::replay invokes them with every recorded call in order. Opening a
+     *  journal checks every published record, and truncates the journal at the first one that is out
+     *  of bounds or fails its checksum, so that a torn write is never replayed. Records appended after
+     *  the last call to sync are not recovered after a crash.
+     *
+     *  Only calls whose parameters are all trivially copyable may be journaled. Pointer parameters
+     *  are stored by value, so they are only meaningful when replayed within the same process.
+     */
+    class DeferredCallJournal
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting a path to the journal file.
+             *  @param path The path to the journal file. It is created if it does not exist.
+             *  @param capacity The number of bytes available for records when creating a new journal.
+             *  Existing journals retain the capacity they were created with.
+             *  @param syncInterval The number of appended records between asynchronous write backs of the
+             *  records. Zero disables them. These do not publish the records; only sync does.
+             *  @throw EasyDelegate::JournalIOException Thrown when the file could not be opened, created,
+             *  or mapped, or when an existing file is not a valid journal.
+             *  @note An existing journal is truncated at its first corrupt record.
+             */
+            DeferredCallJournal(const char* path, const size_t& capacity, const size_t& syncInterval=1024) : mFileDescriptor(-1),
+            mMapping(NULL), mMappingSize(0), mSyncInterval(syncInterval), mUnsyncedRecords(0), mWrittenBackEnd(0), mSyncedEnd(0), mEnd(0),
+            mRecordCount(0)
+            {
+                mFileDescriptor = ::open(path, O_RDWR | O_CREAT, 0644);
+
+                if (mFileDescriptor < 0)
+                    EASYDELEGATE_RAISE(JournalIOException, DELEGATE_ERROR_JOURNAL_IO);
+
+                struct stat fileStatus;
+                if (::fstat(mFileDescriptor, &fileStatus) != 0)
+                {
+                    this->close();
+                    EASYDELEGATE_RAISE(JournalIOException, DELEGATE_ERROR_JOURNAL_IO);
+                }
+
+                const bool created = fileStatus.st_size == 0;
+                mMappingSize = created ? sizeof(JournalHeader) + capacity : static_cast<size_t>(fileStatus.st_size);
+
+                if ((created && ::ftruncate(mFileDescriptor, static_cast<off_t>(mMappingSize)) != 0) || mMappingSize < sizeof(JournalHeader))
+                {
+                    this->close();
+                    EASYDELEGATE_RAISE(JournalIOException, DELEGATE_ERROR_JOURNAL_IO);
+                }
+
+                void* mapping = ::mmap(NULL, mMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, mFileDescriptor, 0);
+                if (mapping == MAP_FAILED)
+                {
+                    this->close();
+                    EASYDELEGATE_RAISE(JournalIOException, DELEGATE_ERROR_JOURNAL_IO);
+                }
+
+                mMapping = static_cast<unsigned char*>(mapping);
+
+                if (created)
+                {
+                    JournalHeader* header = this->getHeader();
+                    header->mMagic = sJournalMagic;
+                    header->mCapacity = capacity;
+                    header->mEnd = 0;
+                    header->mRecordCount = 0;
+                    header->mGeneration = 0;
+                }
+                else if (!this->isValidHeader())
+                {
+                    this->close();
+                    EASYDELEGATE_RAISE(JournalIOException, DELEGATE_ERROR_JOURNAL_IO);
+                }
+                else
+                    this->recover();
+
+                mEnd = mSyncedEnd = mWrittenBackEnd = this->getHeader()->mEnd;
+                mRecordCount = this->getHeader()->mRecordCount;
+            }
+
+            //! The journal owns its mapping and delegates, so it cannot be copied.
+            DeferredCallJournal(const DeferredCallJournal&) = delete;
+
+            //! The journal owns its mapping and delegates, so it cannot be copied.
+            DeferredCallJournal& operator =(const DeferredCallJournal&) = delete;
+
+            //! Standard destructor. Flushes the mapping and deletes all registered delegates.
+            ~DeferredCallJournal(void)
+            {
+                if (mMapping)
+                    this->sync();
+
+                this->close();
+
+                for (auto it = mRegistrations.begin(); it != mRegistrations.end(); ++it)
+                    it->second.mDestroy(it->second.mDelegate);
+            }
+
+            /**
+             *  @brief Registers a delegate to replay all journaled calls with the given method ID.
+             *  @param methodID The ID that journaled calls to this delegate are tagged with.
+             *  @param delegateInstance The delegate to invoke when replaying calls with this ID.
+             *  @warning Ownership of the delegate will be given to the journal, therefore the given delegate
+             *  should not be deleted manually. Registering a method ID again deletes the previous delegate.
+             */
+            template <typename returnType, typename... parameters>
+            void registerMethod(const uint32_t& methodID, ITypedDelegate<returnType, parameters...>* delegateInstance)
+            {
+                static_assert(AllTriviallyCopyable<parameters...>::value, "Journaled calls must only have trivially copyable parameters");
+                assert(delegateInstance);
+
+                auto existing = mRegistrations.find(methodID);
+                if (existing != mRegistrations.end())
+                    existing->second.mDestroy(existing->second.mDelegate);
+
+                Registration& registration = mRegistrations[methodID];
+                registration.mDelegate = delegateInstance;
+                registration.mSignature = &SignatureTag<typename std::decay<parameters>::type...>::sTag;
+                registration.mPayloadSize = PayloadSize<parameters...>::value;
+                registration.mReplay = &DeferredCallJournal::replayRecord<returnType, parameters...>;
+                registration.mDestroy = &DeferredCallJournal::destroyDelegate<returnType, parameters...>;
+            }
+
+            /**
+             *  @brief Registers a static method to replay all journaled calls with the given method ID.
+             *  @param methodID The ID that journaled calls to this method are tagged with.
+             *  @param methodPointer The static method to call when replaying calls with this ID.
+             */
+            template <typename returnType, typename... parameters>
+            void registerMethod(const uint32_t& methodID, const StaticMethodPointer<returnType, parameters...> methodPointer)
+            {
+                this->registerMethod(methodID, new StaticDelegate<returnType, parameters...>(methodPointer));
+            }
+
+            /**
+             *  @brief Registers a class member method to replay all journaled calls with the given method ID.
+             *  @param methodID The ID that journaled calls to this method are tagged with.
+             *  @param methodPointer The class member method to call when replaying calls with this ID.
+             *  @param thisPointer The object to call the member method against.
+             */
+            template <typename classType, typename returnType, typename... parameters>
+            void registerMethod(const uint32_t& methodID, const MemberMethodPointer<classType, returnType, parameters...> methodPointer, classType* thisPointer)
+            {
+                this->registerMethod(methodID, new MemberDelegate<classType, returnType, parameters...>(methodPointer, thisPointer));
+            }
+
+            /**
+             *  @brief Appends a call against the given method ID to the journal.
+             *  @param methodID The registered method ID to tag the call with.
+             *  @param params The arguments of the call. These must match the parameter types the method ID
+             *  was registered with, ignoring references and const. Template arguments may be given explicitly
+             *  to convert the arguments.
+             *  @throw EasyDelegate::InvalidJournalMethodException Thrown when the method ID is not registered
+             *  or was registered with a different signature.
+             *  @throw EasyDelegate::JournalFullException Thrown when the record does not fit in the journal.
+             */
+            template <typename... parameters>
+            void append(const uint32_t& methodID, const parameters&... params)
+            {
+                auto registration = mRegistrations.find(methodID);
+
+                if (registration == mRegistrations.end() || !registration->second.template hasParameters<parameters...>())
+                    EASYDELEGATE_RAISE(InvalidJournalMethodException, DELEGATE_ERROR_INVALID_JOURNAL_METHOD);
+
+                this->appendRecord(methodID, params...);
+            }
+
+            /**
+             *  @brief Invokes the registered delegate of every record in the journal, in the order they
+             *  were appended.
+             *  @return The number of records that were replayed. Replay stops at a record that is out of
+             *  bounds or fails its checksum.
+             *  @throw EasyDelegate::InvalidJournalMethodException Thrown when a record has a method ID that is
+             *  not registered or whose registered signature does not match the record.
+             *  @throw std::exception Any exception can be potentially thrown by the replayed delegates.
+             */
+            size_t replay(void) const
+            {
+                const unsigned char* records = mMapping + sizeof(JournalHeader);
+
+                size_t replayed = 0;
+                for (uint64_t offset = 0, recordSize; offset < mEnd && (recordSize = this->checkRecord(offset, mEnd)) != 0; offset += recordSize)
+                {
+                    RecordHeader record;
+                    memcpy(&record, records + offset, sizeof(RecordHeader));
+
+                    auto registration = mRegistrations.find(record.mMethodID);
+                    if (registration == mRegistrations.end() || registration->second.mPayloadSize != record.mPayloadSize)
+                        EASYDELEGATE_RAISE(InvalidJournalMethodException, DELEGATE_ERROR_INVALID_JOURNAL_METHOD);
+
+                    registration->second.mReplay(registration->second.mDelegate, records + offset + sizeof(RecordHeader));
+                    ++replayed;
+                }
+
+                return replayed;
+            }
+
+            /**
+             *  @brief Discards all records in the journal. This is typically done once every journaled
+             *  call has been processed.
+             *  @details The generation of the journal is advanced, so records left in the file from before
+             *  the reset no longer pass their checksums.
+             */
+            void reset(void)
+            {
+                JournalHeader* header = this->getHeader();
+                header->mEnd = 0;
+                header->mRecordCount = 0;
+                ++header->mGeneration;
+
+                mEnd = 0;
+                mRecordCount = 0;
+                mSyncedEnd = 0;
+                mWrittenBackEnd = 0;
+                mUnsyncedRecords = 0;
+            }
+
+            /**
+             *  @brief Synchronously flushes the journal to disk, writing back the records before publishing
+             *  their end in the header.
+             *  @return A boolean representing whether or not the flush succeeded.
+             */
+            bool sync(void)
+            {
+                const size_t start = this->getPageStart(mSyncedEnd);
+                bool flushed = ::msync(mMapping + start, this->getRecordEnd() - start, MS_SYNC) == 0;
+
+                // Only publish the records once they have been written back
+                if (flushed)
+                {
+                    JournalHeader* header = this->getHeader();
+                    header->mEnd = mEnd;
+                    header->mRecordCount = mRecordCount;
+
+                    mSyncedEnd = mWrittenBackEnd = mEnd;
+                }
+
+                flushed = ::msync(mMapping, this->getHeaderPageSize(), MS_SYNC) == 0 && flushed;
+
+                mUnsyncedRecords = 0;
+                return flushed;
+            }
+
+            /**
+             *  @brief Returns the number of records in the journal.
+             *  @return The number of records in the journal.
+             */
+            EASYDELEGATE_INLINE size_t getRecordCount(void) const EASYDELEGATE_NOEXCEPT { return static_cast<size_t>(mRecordCount); }
+
+            /**
+             *  @brief Returns the number of bytes used by records in the journal.
+             *  @return The number of bytes used by records.
+             */
+            EASYDELEGATE_INLINE size_t getSize(void) const EASYDELEGATE_NOEXCEPT { return static_cast<size_t>(mEnd); }
+
+            /**
+             *  @brief Returns the number of bytes available for records in the journal.
+             *  @return The capacity of the journal.
+             */
+            EASYDELEGATE_INLINE size_t getCapacity(void) const EASYDELEGATE_NOEXCEPT { return static_cast<size_t>(this->getHeader()->mCapacity); }
+
+        // Private Methods
+        private:
+            //! The header stored at the start of the journal file.
+            struct JournalHeader
+            {
+                //! Identifies the file as a journal.
+                uint64_t mMagic;
+                //! The number of bytes available for records.
+                uint64_t mCapacity;
+                //! The number of bytes used by records that have been written back.
+                uint64_t mEnd;
+                //! The number of records that have been written back.
+                uint64_t mRecordCount;
+                //! Advanced on every reset and seeded into every record checksum.
+                uint64_t mGeneration;
+            };
+
+            //! The header stored in front of each record.
+            struct RecordHeader
+            {
+                //! The registered method ID of the call.
+                uint32_t mMethodID;
+                //! The number of bytes of arguments following this header.
+                uint32_t mPayloadSize;
+                //! The checksum of the method ID, the payload size and the payload, seeded with the generation.
+                uint64_t mChecksum;
+            };
+
+            //! Type erased method used to decode a record and invoke the registered delegate.
+            typedef void (*ReplayMethod)(IDelegate* delegateInstance, const unsigned char* payload);
+            //! Type erased method used to delete a registered delegate through its typed interface.
+            typedef void (*DestroyMethod)(IDelegate* delegateInstance);
+
+            //! A delegate registered against a method ID.
+            struct Registration
+            {
+                //! The delegate to replay calls through.
+                IDelegate* mDelegate;
+                //! Uniquely identifies the parameter list of the delegate.
+                const char* mSignature;
+                //! The number of bytes of arguments in each record.
+                size_t mPayloadSize;
+                //! Decodes a record and invokes the delegate.
+                ReplayMethod mReplay;
+                //! Deletes the delegate.
+                DestroyMethod mDestroy;
+
+                //! Returns whether or not this registration was made for the given parameter list.
+                template <typename... parameters>
+                bool hasParameters(void) const EASYDELEGATE_NOEXCEPT
+                {
+                    return mSignature == &SignatureTag<typename std::decay<parameters>::type...>::sTag;
+                }
+            };
+
+            /**
+             *  @brief Helper template whose static member has a unique address for every type list,
+             *  allowing signatures to be compared without RTTI.
+             */
+            template <typename... types>
+            struct SignatureTag
+            {
+                //! The member whose address identifies the type list.
+                static const char sTag;
+            };
+
+            //! Helper template determining whether every type in a list is trivially copyable.
+            template <typename... types>
+            struct AllTriviallyCopyable : std::true_type { };
+
+            //! Helper template determining whether every type in a list is trivially copyable.
+            template <typename type, typename... types>
+            struct AllTriviallyCopyable<type, types...> : std::integral_constant<bool, std::is_trivially_copyable<typename std::decay<type>::type>::value &&
+            AllTriviallyCopyable<types...>::value> { };
+
+            //! Helper template computing the number of bytes the arguments of a call occupy in a record.
+            template <typename... types>
+            struct PayloadSize : std::integral_constant<size_t, 0> { };
+
+            //! Helper template computing the number of bytes the arguments of a call occupy in a record.
+            template <typename type, typename... types>
+            struct PayloadSize<type, types...> : std::integral_constant<size_t, sizeof(typename std::decay<type>::type) + PayloadSize<types...>::value> { };
+
+            /**
+             *  @brief Returns the number of bytes a record occupies in the journal, padded so that every
+             *  record header remains aligned.
+             *  @param payloadSize The number of bytes of arguments in the record.
+             *  @return The size of the record.
+             */
+            static EASYDELEGATE_CONSTEXPR uint64_t getRecordSize(const uint64_t& payloadSize) EASYDELEGATE_NOEXCEPT
+            {
+                return (sizeof(RecordHeader) + payloadSize + sizeof(uint64_t) - 1) & ~static_cast<uint64_t>(sizeof(uint64_t) - 1);
+            }
+
+            //! Folds the given bytes into a 64 bit FNV-1a hash.
+            static EASYDELEGATE_INLINE uint64_t hashBytes(uint64_t hash, const unsigned char* bytes, const size_t& size) EASYDELEGATE_NOEXCEPT
+            {
+                for (size_t index = 0; index < size; ++index)
+                    hash = (hash ^ bytes[index]) * 0x100000001B3ULL;
+
+                return hash;
+            }
+
+            /**
+             *  @brief Computes the checksum of a record.
+             *  @param generation The generation of the journal the record was written in.
+             *  @param record The header of the record. Its checksum is not included.
+             *  @param payload The arguments following the header.
+             *  @return The checksum of the record.
+             */
+            static uint64_t getChecksum(const uint64_t& generation, const RecordHeader& record, const unsigned char* payload) EASYDELEGATE_NOEXCEPT
+            {
+                uint64_t hash = hashBytes(0xCBF29CE484222325ULL, reinterpret_cast<const unsigned char*>(&generation), sizeof(generation));
+                hash = hashBytes(hash, reinterpret_cast<const unsigned char*>(&record.mMethodID), sizeof(record.mMethodID));
+                hash = hashBytes(hash, reinterpret_cast<const unsigned char*>(&record.mPayloadSize), sizeof(record.mPayloadSize));
+                return hashBytes(hash, payload, record.mPayloadSize);
+            }
+
+            /**
+             *  @brief Checks the record at the given offset.
+             *  @param offset The offset of the record from the first record.
+             *  @param end The offset the record must end at or before.
+             *  @return The size of the record, or 0 if it does not fit before the end or fails its checksum.
+             */
+            uint64_t checkRecord(const uint64_t& offset, const uint64_t& end) const EASYDELEGATE_NOEXCEPT
+            {
+                if (end - offset < sizeof(RecordHeader))
+                    return 0;
+
+                const unsigned char* position = mMapping + sizeof(JournalHeader) + offset;
+
+                RecordHeader record;
+                memcpy(&record, position, sizeof(RecordHeader));
+
+                const uint64_t recordSize = getRecordSize(record.mPayloadSize);
+                if (recordSize > end - offset || record.mChecksum != getChecksum(this->getHeader()->mGeneration, record, position + sizeof(RecordHeader)))
+                    return 0;
+
+                return recordSize;
+            }
+
+            //! Returns whether or not the header of an existing journal is consistent with the file.
+            bool isValidHeader(void) const EASYDELEGATE_NOEXCEPT
+            {
+                const JournalHeader* header = this->getHeader();
+
+                return header->mMagic == sJournalMagic && header->mCapacity <= mMappingSize - sizeof(JournalHeader) &&
+                header->mEnd <= header->mCapacity && header->mEnd % sizeof(uint64_t) == 0;
+            }
+
+            //! Truncates an existing journal at its first record that is out of bounds or fails its checksum.
+            void recover(void) EASYDELEGATE_NOEXCEPT
+            {
+                JournalHeader* header = this->getHeader();
+
+                uint64_t end = 0;
+                uint64_t recordCount = 0;
+                for (uint64_t recordSize; end < header->mEnd && (recordSize = this->checkRecord(end, header->mEnd)) != 0; end += recordSize)
+                    ++recordCount;
+
+                if (end == header->mEnd && recordCount == header->mRecordCount)
+                    return;
+
+                header->mEnd = end;
+                header->mRecordCount = recordCount;
+                ::msync(mMapping, this->getHeaderPageSize(), MS_SYNC);
+            }
+
+            //! Copies a single argument into the mapping, advancing the write position.
+            template <typename type>
+            static EASYDELEGATE_INLINE int encode(unsigned char*& position, const type& value) EASYDELEGATE_NOEXCEPT
+            {
+                memcpy(position, &value, sizeof(type));
+                position += sizeof(type);
+                return 0;
+            }
+
+            //! Copies a single argument out of a record, advancing the read position.
+            template <typename type>
+            static EASYDELEGATE_INLINE int decode(const unsigned char*& position, type& value) EASYDELEGATE_NOEXCEPT
+            {
+                memcpy(&value, position, sizeof(type));
+                position += sizeof(type);
+                return 0;
+            }
+
+            //! Writes a record directly into the mapping and commits it.
+            template <typename... parameters>
+            void appendRecord(const uint32_t& methodID, const parameters&... params)
+            {
+                JournalHeader* header = this->getHeader();
+
+                const uint64_t recordSize = getRecordSize(PayloadSize<parameters...>::value);
+                if (mEnd + recordSize > header->mCapacity)
+                    EASYDELEGATE_RAISE(JournalFullException, DELEGATE_ERROR_JOURNAL_FULL);
+
+                unsigned char* record = mMapping + sizeof(JournalHeader) + mEnd;
+
+                // Braced initializers are evaluated in order, so arguments are written sequentially
+                unsigned char* position = record + sizeof(RecordHeader);
+                const int expansion[] = { 0, encode(position, static_cast<const typename std::decay<parameters>::type&>(params))... };
+                (void)expansion;
+
+                RecordHeader recordHeader;
+                recordHeader.mMethodID = methodID;
+                recordHeader.mPayloadSize = static_cast<uint32_t>(PayloadSize<parameters...>::value);
+                recordHeader.mChecksum = getChecksum(header->mGeneration, recordHeader, record + sizeof(RecordHeader));
+                memcpy(record, &recordHeader, sizeof(RecordHeader));
+
+                mEnd += recordSize;
+                ++mRecordCount;
+
+                if (mSyncInterval && ++mUnsyncedRecords >= mSyncInterval)
+                    this->writeBackAsync();
+            }
+
+            //! Returns the number of bytes from the start of the mapping that hold the journal header.
+            EASYDELEGATE_INLINE size_t getHeaderPageSize(void) const EASYDELEGATE_NOEXCEPT
+            {
+                const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+                return pageSize < mMappingSize ? pageSize : mMappingSize;
+            }
+
+            //! Returns the offset into the mapping of the page holding the given record offset.
+            EASYDELEGATE_INLINE size_t getPageStart(const uint64_t& offset) const EASYDELEGATE_NOEXCEPT
+            {
+                const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+                return (sizeof(JournalHeader) + static_cast<size_t>(offset)) & ~(pageSize - 1);
+            }
+
+            //! Returns the offset into the mapping past the last record appended.
+            EASYDELEGATE_INLINE size_t getRecordEnd(void) const EASYDELEGATE_NOEXCEPT { return sizeof(JournalHeader) + static_cast<size_t>(mEnd); }
+
+            /**
+             *  @brief Starts an asynchronous write back of the records appended since the last one, without
+             *  waiting for it or publishing them.
+             */
+            void writeBackAsync(void)
+            {
+                const size_t start = this->getPageStart(mWrittenBackEnd);
+                ::msync(mMapping + start, this->getRecordEnd() - start, MS_ASYNC);
+
+                mWrittenBackEnd = mEnd;
+                mUnsyncedRecords = 0;
+            }
+
+            //! Decodes a record into a tuple of arguments and invokes the delegate with them.
+            template <typename returnType, typename... parameters>
+            static void replayRecord(IDelegate* delegateInstance, const unsigned char* payload)
+            {
+                std::tuple<typename std::decay<parameters>::type...> arguments;
+
+                const unsigned char* position = payload;
+                replayDecode(position, arguments, typename gens<sizeof...(parameters)>::type());
+                replayInvoke(static_cast<ITypedDelegate<returnType, parameters...>*>(delegateInstance), arguments, typename gens<sizeof...(parameters)>::type());
+            }
+
+            //! Deletes a registered delegate through its typed interface, which has a virtual destructor.
+            template <typename returnType, typename... parameters>
+            static void destroyDelegate(IDelegate* delegateInstance)
+            {
+                delete static_cast<ITypedDelegate<returnType, parameters...>*>(delegateInstance);
+            }
+
+            //! Internal templated method to decode every argument of a record.
+            template <typename tupleType, int ...S>
+            static EASYDELEGATE_INLINE void replayDecode(const unsigned char*& position, tupleType& arguments, seq<S...>) EASYDELEGATE_NOEXCEPT
+            {
+                const int expansion[] = { 0, decode(position, std::get<S>(arguments))... };
+                (void)expansion;
+            }
+
+            //! Internal templated method to invoke a delegate with decoded arguments.
+            template <typename delegateType, typename tupleType, int ...S>
+            static EASYDELEGATE_INLINE void replayInvoke(delegateType* delegateInstance, tupleType& arguments, seq<S...>)
+            {
+                delegateInstance->invoke(std::get<S>(arguments)...);
+            }
+
+            //! Returns the header at the start of the mapping.
+            EASYDELEGATE_INLINE JournalHeader* getHeader(void) EASYDELEGATE_NOEXCEPT { return reinterpret_cast<JournalHeader*>(mMapping); }
+
+            //! Returns the header at the start of the mapping.
+            EASYDELEGATE_INLINE const JournalHeader* getHeader(void) const EASYDELEGATE_NOEXCEPT { return reinterpret_cast<const JournalHeader*>(mMapping); }
+
+            //! Unmaps and closes the journal file.
+            void close(void) EASYDELEGATE_NOEXCEPT
+            {
+                if (mMapping)
+                    ::munmap(mMapping, mMappingSize);
+
+                if (mFileDescriptor >= 0)
+                    ::close(mFileDescriptor);
+
+                mMapping = NULL;
+                mFileDescriptor = -1;
+            }
+
+            //! Identifies a journal file. The characters "EDJRNL02" in little endian.
+            static const uint64_t sJournalMagic = 0x32304C4E524A4445ULL;
+
+        // Private Members
+        private:
+            //! The file descriptor of the journal file.
+            int mFileDescriptor;
+            //! The start of the journal file mapping.
+            unsigned char* mMapping;
+            //! The size of the journal file mapping.
+            size_t mMappingSize;
+
+            //! The number of records between asynchronous write backs.
+            const size_t mSyncInterval;
+            //! The number of records appended since the last write back.
+            size_t mUnsyncedRecords;
+            //! The end of the journal at the last asynchronous write back.
+            uint64_t mWrittenBackEnd;
+            //! The end of the journal published at the last sync.
+            uint64_t mSyncedEnd;
+            //! The end of the last record appended.
+            uint64_t mEnd;
+            //! The number of records appended.
+            uint64_t mRecordCount;
+
+            //! The delegates registered against each method ID.
+            std::unordered_map<uint32_t, Registration> mRegistrations;
+    };
+
+    template <typename... types>
+    const char DeferredCallJournal::SignatureTag<types...>::sTag = 0;
+} // End NameSpace EasyDelegate
+#endif // _INCLUDE_EASYDELEGATE_DEFERREDJOURNAL_HPP_
+#endif // EASYDELEGATE_NO_DEFERRED_CALLING
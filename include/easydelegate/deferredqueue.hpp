@@ -0,0 +1,908 @@
+/**
+ *  @file deferredqueue.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the DeferredCallQueue type, a prioritized queue of deferred
+ *  callers that can be drained against a time or call count budget.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(EASYDELEGATE_NO_DEFERRED_CALLING) && ISCPP11
+
+#ifndef _INCLUDE_EASYDELEGATE_DEFERREDQUEUE_HPP_
+#define _INCLUDE_EASYDELEGATE_DEFERREDQUEUE_HPP_
+
+#include <assert.h>     // assert(expr)
+#include <chrono>       // std::chrono::steady_clock
+#include <deque>        // std::deque
+#include <memory>       // std::unique_ptr
+#include <unordered_map>
+#include <vector>       // std::vector
+
+#include "deferredcallers.hpp"
+#include "histogram.hpp"
+#include "accounting.hpp"
+
+namespace EasyDelegate
+{
+    /**
+     *  @brief Describes how much work a single DeferredCallQueue::drain call is allowed to
+     *  perform before it returns and leaves the remainder for the next drain.
+     *  @details A limit of zero means that the given dimension is unbounded. A budget with
+     *  both limits set stops at whichever limit is reached first.
+     */
+    struct DrainBudget
+    {
+        //! The maximum number of deferred callers to dispatch. Zero means no limit.
+        size_t mMaximumCalls;
+
+        //! The maximum amount of time to spend dispatching. Zero means no limit.
+        std::chrono::nanoseconds mMaximumTime;
+
+        /**
+         *  @brief Constructor accepting a call count limit and a time limit.
+         *  @param maximumCalls The maximum number of deferred callers to dispatch.
+         *  @param maximumTime The maximum amount of time to spend dispatching.
+         */
+        DrainBudget(const size_t& maximumCalls=0, const std::chrono::nanoseconds& maximumTime=std::chrono::nanoseconds::zero()) EASYDELEGATE_NOEXCEPT :
+        mMaximumCalls(maximumCalls), mMaximumTime(maximumTime) { }
+
+        /**
+         *  @brief Helper method to construct a budget limited only by a call count.
+         *  @param maximumCalls The maximum number of deferred callers to dispatch.
+         *  @return A DrainBudget limited to the given number of calls.
+         */
+        static DrainBudget calls(const size_t& maximumCalls) EASYDELEGATE_NOEXCEPT { return DrainBudget(maximumCalls); }
+
+        /**
+         *  @brief Helper method to construct a budget limited only by time.
+         *  @param maximumTime The maximum amount of time to spend dispatching.
+         *  @return A DrainBudget limited to the given amount of time.
+         */
+        template <typename rep, typename period>
+        static DrainBudget time(const std::chrono::duration<rep, period>& maximumTime) EASYDELEGATE_NOEXCEPT
+        {
+            return DrainBudget(0, std::chrono::duration_cast<std::chrono::nanoseconds>(maximumTime));
+        }
+    };
+
+    /**
+     *  @brief Statistics gathered by a DeferredCallQueue across its budgeted drains. These are
+     *  intended to be used when tuning the budgets given to DeferredCallQueue::drain.
+     */
+    struct DrainStatistics
+    {
+        //! The number of budgeted drains performed.
+        size_t mDrainCount;
+        //! The total number of deferred callers dispatched by budgeted drains.
+        size_t mDispatchCount;
+        //! The number of drains that ran out of budget while work was still pending.
+        size_t mExhaustedCount;
+        //! The number of drains that ran past their time budget.
+        size_t mOverrunCount;
+        //! The number of deferred callers that were promoted to a higher priority, or into the overdue list, due to aging.
+        size_t mPromotionCount;
+
+        //! The total time spent in budgeted drains.
+        std::chrono::nanoseconds mTotalDrainTime;
+        //! The longest time spent in a single budgeted drain.
+        std::chrono::nanoseconds mMaximumDrainTime;
+        //! The total amount of time that drains ran past their time budget.
+        std::chrono::nanoseconds mTotalOverrunTime;
+        //! The largest amount of time a single drain ran past its time budget.
+        std::chrono::nanoseconds mMaximumOverrunTime;
+
+        //! Standard constructor, zeroing all statistics.
+        DrainStatistics(void) EASYDELEGATE_NOEXCEPT : mDrainCount(0), mDispatchCount(0), mExhaustedCount(0), mOverrunCount(0),
+        mPromotionCount(0), mTotalDrainTime(0), mMaximumDrainTime(0), mTotalOverrunTime(0), mMaximumOverrunTime(0) { }
+    };
+
+    /**
+     *  @brief A queue of deferred callers split into priority classes.
+     *  @details Priority class 0 is the most urgent and is always drained first. Deferred callers
+     *  within a single priority class are dispatched in the order they were pushed. To prevent
+     *  starvation, a deferred caller that has been passed over by a given number of drains is
+     *  promoted into the next most urgent priority class. One passed over that many drains in the
+     *  most urgent class is moved to an overdue list dispatched ahead of it, in the order the
+     *  deferred callers became overdue.
+     *
+     *  The queue takes ownership of all deferred callers pushed to it and deletes them once they
+     *  have been dispatched or when the queue itself is destroyed.
+     *
+     *  Pending deferred callers are indexed by the this pointer they call against, so that every
+     *  pending call against an object can be cancelled in time proportional to the number of such
+     *  calls. Cancelled calls are deleted immediately and skipped when they reach the front of the
+     *  queue.
+     *
+     *  Queues whose calls commute may enable locality ordering, in which case each priority class is
+     *  reordered before draining so that calls to the same method, and then against the same this
+     *  pointer, run back to back. Calls against the same target retain their relative order.
+     */
+    class DeferredCallQueue
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the number of priority classes and the aging threshold.
+             *  @param priorityCount The number of priority classes in this queue. Must be at least one.
+             *  @param agingThreshold The number of drains a deferred caller may wait in a priority class
+             *  before it is promoted to the next most urgent class. Zero disables aging.
+             */
+            DeferredCallQueue(const unsigned int& priorityCount=1, const size_t& agingThreshold=0) :
+            mQueues(this->getStorageAllocator()), mGrouped(priorityCount ? priorityCount : 1, true, this->getStorageAllocator()),
+            mInEntryOrder(mGrouped.size(), true, this->getStorageAllocator()), mOverdue(this->getStorageAllocator()), mSlots(this->getStorageAllocator()), mFreeSlots(this->getStorageAllocator()), mThisPointerIndex(this->getStorageAllocator()),
+            mAgingThreshold(agingThreshold), mDrainSequence(0), mSize(0), mLocalityOrdering(false), mMethodHashes(this->getStorageAllocator()),
+            mTargets(this->getStorageAllocator()), mTargetGroups(this->getStorageAllocator()), mTargetOrder(this->getStorageAllocator()),
+            mTargetStarts(this->getStorageAllocator()), mGroupStarts(this->getStorageAllocator()), mEntryTargets(this->getStorageAllocator()),
+            mGroupedEntries(this->getStorageAllocator()), mOrderedEntries(this->getStorageAllocator())
+            {
+                // Each class is moved in rather than copied, so that it keeps this queue's allocator
+                mQueues.reserve(mGrouped.size());
+                for (size_t priority = 0; priority < mGrouped.size(); ++priority)
+                    mQueues.push_back(PriorityClass(this->getStorageAllocator()));
+            }
+
+            //! The queue owns its pending deferred callers, so it cannot be copied.
+            DeferredCallQueue(const DeferredCallQueue&) = delete;
+
+            //! The queue owns its pending deferred callers, so it cannot be copied.
+            DeferredCallQueue& operator =(const DeferredCallQueue&) = delete;
+
+            //! Standard destructor. All pending deferred callers are deleted without being dispatched.
+            ~DeferredCallQueue(void)
+            {
+                this->clear();
+            }
+
+            /**
+             *  @brief Pushes a deferred caller onto the end of the given priority class.
+             *  @param caller The deferred caller to push.
+             *  @param priority The priority class to push to, where 0 is the most urgent. Values past the
+             *  last priority class are clamped to the least urgent class.
+             *  @warning Ownership of the deferred caller will be given to the queue, therefore it should not
+             *  be deleted manually.
+             */
+            void push(IDeferredCaller* caller, const unsigned int& priority=0)
+            {
+                assert(caller);
+
+                size_t slot;
+                if (mFreeSlots.empty())
+                {
+                    slot = mSlots.size();
+                    mSlots.push_back(CallSlot());
+                }
+                else
+                {
+                    slot = mFreeSlots.back();
+                    mFreeSlots.pop_back();
+                }
+
+                CallSlot& callSlot = mSlots[slot];
+                callSlot.mCaller = caller;
+                callSlot.mThisPointer = caller->getThisPointer();
+                callSlot.mMethodHash = caller->getMethodHash();
+
+                #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                    callSlot.mEnqueueTicks = TimestampCounter::read();
+                #endif
+
+                if (callSlot.mThisPointer)
+                {
+                    auto found = mThisPointerIndex.find(callSlot.mThisPointer);
+                    if (found == mThisPointerIndex.end())
+                        found = mThisPointerIndex.insert(std::make_pair(callSlot.mThisPointer, IndexList(this->getStorageAllocator()))).first;
+
+                    IndexList& indexed = found->second;
+                    callSlot.mIndexPosition = indexed.size();
+                    indexed.push_back(slot);
+                }
+
+                const size_t priorityClass = priority < mQueues.size() ? priority : mQueues.size() - 1;
+                mQueues[priorityClass].push_back(QueueEntry(slot, mDrainSequence));
+                mGrouped[priorityClass] = false;
+                ++mSize;
+            }
+
+            /**
+             *  @brief Cancels every pending deferred caller that calls against the given this pointer.
+             *  This is typically called when the object is being destroyed.
+             *  @param thisPointer The address of the object to check against.
+             *  @return The number of deferred callers that were cancelled.
+             *  @details The cancelled deferred callers are deleted immediately, while their queue entries
+             *  are left in place and skipped when drained. This runs in time proportional to the number of
+             *  cancelled deferred callers rather than the length of the queue.
+             *  @warning A deferred caller is indexed by the this pointer it had when it was pushed. Changing
+             *  the mThisPointer of a pending DeferredMemberCaller is not supported.
+             */
+            size_t cancelByThisPointer(const void* thisPointer)
+            {
+                auto indexed = mThisPointerIndex.find(thisPointer);
+                if (indexed == mThisPointerIndex.end())
+                    return 0;
+
+                // Take the index entry first, as destructors could otherwise observe a partially cancelled index
+                IndexList slots(indexed->second.get_allocator());
+                slots.swap(indexed->second);
+                mThisPointerIndex.erase(indexed);
+
+                for (auto it = slots.begin(); it != slots.end(); ++it)
+                {
+                    CallSlot& callSlot = mSlots[*it];
+                    IDeferredCaller* caller = callSlot.mCaller;
+
+                    callSlot.mCaller = NULL;
+                    callSlot.mThisPointer = NULL;
+                    --mSize;
+
+                    delete caller;
+                }
+
+                return slots.size();
+            }
+
+            /**
+             *  @brief Returns whether or not any pending deferred caller calls against the given this pointer.
+             *  @param thisPointer A pointer referring to the object of interest.
+             *  @return A boolean representing whether or not a pending deferred caller calls a member function
+             *  against the given this pointer.
+             */
+            EASYDELEGATE_INLINE bool hasThisPointer(const void* thisPointer) const { return mThisPointerIndex.find(thisPointer) != mThisPointerIndex.end(); }
+
+            /**
+             *  @brief Dispatches every pending deferred caller, including any that are pushed while
+             *  draining.
+             *  @return The number of deferred callers that were dispatched.
+             *  @note If a deferred caller throws an exception, it is deleted and the drain halts.
+             */
+            size_t drain(void)
+            {
+                this->age();
+
+                if (mLocalityOrdering)
+                    this->group();
+
+                size_t dispatched = 0;
+                while (this->dispatchNext())
+                    ++dispatched;
+
+                return dispatched;
+            }
+
+            /**
+             *  @brief Dispatches pending deferred callers in priority order until the queue is empty or
+             *  the given budget has been used up. Anything not dispatched remains for the next drain.
+             *  @param budget The budget for this drain.
+             *  @return The number of deferred callers that were dispatched.
+             *  @note A single deferred caller cannot be interrupted, so a drain may run past its time
+             *  budget. The amount it ran over by is recorded in the drain statistics.
+             *  @note If a deferred caller throws an exception, it is deleted and the drain halts.
+             */
+            size_t drain(const DrainBudget& budget)
+            {
+                this->age();
+
+                if (mLocalityOrdering)
+                    this->group();
+
+                const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                const bool timeLimited = budget.mMaximumTime > std::chrono::nanoseconds::zero();
+
+                size_t dispatched = 0;
+                std::chrono::nanoseconds elapsed(0);
+                while (!budget.mMaximumCalls || dispatched < budget.mMaximumCalls)
+                {
+                    if (!this->dispatchNext())
+                        break;
+
+                    ++dispatched;
+
+                    if (timeLimited)
+                    {
+                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+                        if (elapsed >= budget.mMaximumTime)
+                            break;
+                    }
+                }
+
+                if (!timeLimited)
+                    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+                ++mStatistics.mDrainCount;
+                mStatistics.mDispatchCount += dispatched;
+                mStatistics.mTotalDrainTime += elapsed;
+
+                if (elapsed > mStatistics.mMaximumDrainTime)
+                    mStatistics.mMaximumDrainTime = elapsed;
+
+                if (mSize)
+                    ++mStatistics.mExhaustedCount;
+
+                if (timeLimited && elapsed > budget.mMaximumTime)
+                {
+                    const std::chrono::nanoseconds overrun = elapsed - budget.mMaximumTime;
+
+                    ++mStatistics.mOverrunCount;
+                    mStatistics.mTotalOverrunTime += overrun;
+
+                    if (overrun > mStatistics.mMaximumOverrunTime)
+                        mStatistics.mMaximumOverrunTime = overrun;
+                }
+
+                return dispatched;
+            }
+
+            /**
+             *  @brief Deletes all pending deferred callers without dispatching them.
+             */
+            void clear(void)
+            {
+                for (auto queue = mQueues.begin(); queue != mQueues.end(); ++queue)
+                    queue->clear();
+
+                mOverdue.clear();
+
+                // Release everything before deleting, in case a destructor touches this queue
+                SlotStorage slots(mSlots.get_allocator());
+                slots.swap(mSlots);
+                mFreeSlots.clear();
+                mThisPointerIndex.clear();
+                mSize = 0;
+
+                for (auto it = slots.begin(); it != slots.end(); ++it)
+                    delete it->mCaller;
+            }
+
+            /**
+             *  @brief Returns the number of pending deferred callers across all priority classes.
+             *  @return The number of pending deferred callers.
+             */
+            EASYDELEGATE_INLINE size_t size(void) const EASYDELEGATE_NOEXCEPT { return mSize; }
+
+            /**
+             *  @brief Returns the number of pending deferred callers in the given priority class.
+             *  @param priority The priority class of interest.
+             *  @return The number of pending deferred callers in that class, including cancelled deferred
+             *  callers that have not been skipped over yet. Overdue deferred callers count towards class 0.
+             */
+            EASYDELEGATE_INLINE size_t size(const unsigned int& priority) const { return mQueues.at(priority).size() + (priority ? 0 : mOverdue.size()); }
+
+            /**
+             *  @brief Returns whether or not this queue has no pending deferred callers.
+             *  @return A boolean representing whether or not the queue is empty.
+             */
+            EASYDELEGATE_INLINE bool empty(void) const EASYDELEGATE_NOEXCEPT { return mSize == 0; }
+
+            /**
+             *  @brief Returns the number of priority classes in this queue.
+             *  @return The number of priority classes.
+             */
+            EASYDELEGATE_INLINE unsigned int getPriorityCount(void) const EASYDELEGATE_NOEXCEPT { return static_cast<unsigned int>(mQueues.size()); }
+
+            /**
+             *  @brief Sets whether or not pending deferred callers are reordered for locality when drained.
+             *  @param enabled A boolean representing whether or not locality ordering should be used.
+             *  @details When enabled, each priority class is grouped by the method called, as identified by
+             *  IDeferredCaller::getMethodHash, and then by this pointer. Deferred callers that hasSameMethodAs
+             *  considers equal always share a group. Each class is regrouped only when calls
+             *  have been added to it since it was last grouped.
+             *  @warning This should only be enabled when the order in which calls to different targets run does
+             *  not matter.
+             */
+            EASYDELEGATE_INLINE void setLocalityOrdering(const bool& enabled) EASYDELEGATE_NOEXCEPT { mLocalityOrdering = enabled; }
+
+            /**
+             *  @brief Returns whether or not pending deferred callers are reordered for locality when drained.
+             *  @return A boolean representing whether or not locality ordering is used.
+             */
+            EASYDELEGATE_INLINE bool getLocalityOrdering(void) const EASYDELEGATE_NOEXCEPT { return mLocalityOrdering; }
+
+            /**
+             *  @brief Returns the statistics gathered across all budgeted drains.
+             *  @return A reference to the drain statistics of this queue.
+             */
+            EASYDELEGATE_INLINE const DrainStatistics& getStatistics(void) const EASYDELEGATE_NOEXCEPT { return mStatistics; }
+
+            //! Resets the drain statistics of this queue.
+            EASYDELEGATE_INLINE void resetStatistics(void) EASYDELEGATE_NOEXCEPT { mStatistics = DrainStatistics(); }
+
+            #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                /**
+                 *  @brief Returns the histogram of the time each dispatched deferred caller spent queued, from being
+                 *  pushed to the start of its dispatch.
+                 *  @return A const reference to the histogram. Histograms of several queues can be combined with
+                 *  LatencyHistogram::merge.
+                 */
+                EASYDELEGATE_INLINE const LatencyHistogram& getQueueLatency(void) const EASYDELEGATE_NOEXCEPT { return mQueueLatency; }
+
+                //! Removes every value from the queue latency histogram.
+                EASYDELEGATE_INLINE void resetQueueLatency(void) EASYDELEGATE_NOEXCEPT { mQueueLatency.reset(); }
+            #endif
+
+            #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                /**
+                 *  @brief Returns the allocations made for this queue's own storage.
+                 *  @return A snapshot of the live and peak storage of the queue. The deferred callers it holds are
+                 *  accounted by kind through AllocationAccounting::getCounter.
+                 */
+                EASYDELEGATE_INLINE AllocationSnapshot getStorageAllocations(void) const EASYDELEGATE_NOEXCEPT { return mStorageAllocations.getSnapshot(); }
+            #endif
+
+        // Private Methods
+        private:
+            //! Storage for a pending deferred caller, kept at a stable index while it is queued.
+            struct CallSlot
+            {
+                CallSlot(void) EASYDELEGATE_NOEXCEPT : mCaller(NULL), mThisPointer(NULL), mIndexPosition(0), mMethodHash(0) { }
+
+                //! The pending deferred caller. NULL if it has been cancelled.
+                IDeferredCaller* mCaller;
+                //! The this pointer the deferred caller was indexed under. NULL if it is not indexed.
+                const void* mThisPointer;
+                //! The position of this slot within the this pointer index.
+                size_t mIndexPosition;
+                //! The method hash of the deferred caller, recorded for grouping while the caller is hot in cache.
+                size_t mMethodHash;
+
+                #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                    //! The TimestampCounter tick count when the deferred caller was pushed.
+                    uint64_t mEnqueueTicks;
+                #endif
+            };
+
+            //! A queued slot along with the drain sequence it entered its priority class at.
+            struct QueueEntry
+            {
+                QueueEntry(const size_t& slot, const size_t& sequence) EASYDELEGATE_NOEXCEPT : mSlot(slot), mSequence(sequence) { }
+
+                //! The index of the slot holding the deferred caller.
+                size_t mSlot;
+                //! The drain sequence at which this entry entered its current priority class.
+                size_t mSequence;
+            };
+
+            //! Storage for the slots of pending deferred callers.
+            typedef std::vector<CallSlot, StorageAllocator<CallSlot> > SlotStorage;
+            //! A list of slot or bucket indices.
+            typedef std::vector<size_t, StorageAllocator<size_t> > IndexList;
+            //! A list of queue entries.
+            typedef std::vector<QueueEntry, StorageAllocator<QueueEntry> > EntryList;
+            //! The queued entries of a single priority class.
+            typedef std::deque<QueueEntry, StorageAllocator<QueueEntry> > PriorityClass;
+
+            //! Returns the allocator every container of this queue allocates through.
+            EASYDELEGATE_INLINE StorageAllocator<char> getStorageAllocator(void) EASYDELEGATE_NOEXCEPT
+            {
+                #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                    return StorageAllocator<char>(&mStorageAllocations);
+                #else
+                    return StorageAllocator<char>();
+                #endif
+            }
+
+            /**
+             *  @brief Begins a new drain, promoting any deferred callers that have waited in their priority
+             *  class for at least the aging threshold.
+             *  @details A priority class that is in order of entry only needs its front inspected. One that
+             *  has been grouped for locality since it was last empty is scanned in full instead, as grouping
+             *  can place its oldest entries behind newer ones. Only then can the most urgent class have
+             *  overdue entries. Classes are visited from most to least urgent
+             *  so that a deferred caller moves at most one class per drain. As every entry crosses the
+             *  threshold on exactly one drain, the overdue list stays in order of entry.
+             */
+            void age(void)
+            {
+                ++mDrainSequence;
+
+                if (!mAgingThreshold)
+                    return;
+
+                for (size_t priority = 0; priority < mQueues.size(); ++priority)
+                {
+                    PriorityClass& queue = mQueues[priority];
+
+                    if (queue.empty())
+                    {
+                        mInEntryOrder[priority] = true;
+                        continue;
+                    }
+
+                    // The most urgent class is dispatched in order of entry already, so nothing in it is overdue
+                    if (mInEntryOrder[priority])
+                    {
+                        while (priority && !queue.empty() && mDrainSequence - queue.front().mSequence >= mAgingThreshold)
+                        {
+                            this->promote(queue.front(), priority);
+                            queue.pop_front();
+                        }
+
+                        continue;
+                    }
+
+                    // Compact the entries that stay, keeping their grouped order
+                    size_t keptCount = 0;
+                    for (size_t entry = 0; entry < queue.size(); ++entry)
+                    {
+                        const QueueEntry current = queue[entry];
+
+                        if (mDrainSequence - current.mSequence >= mAgingThreshold)
+                            this->promote(current, priority);
+                        else
+                            queue[keptCount++] = current;
+                    }
+
+                    queue.erase(queue.begin() + keptCount, queue.end());
+                }
+            }
+
+            /**
+             *  @brief Moves an entry into the priority class ahead of the given one, restarting its wait there,
+             *  or into the overdue list if it is in the most urgent class.
+             *  @param entry The entry to promote.
+             *  @param priority The priority class the entry is leaving.
+             */
+            EASYDELEGATE_INLINE void promote(const QueueEntry& entry, const size_t& priority)
+            {
+                if (priority)
+                {
+                    mQueues[priority - 1].push_back(QueueEntry(entry.mSlot, mDrainSequence));
+                    mGrouped[priority - 1] = false;
+                }
+                else
+                    mOverdue.push_back(entry);
+
+                ++mStatistics.mPromotionCount;
+            }
+
+            /**
+             *  @brief A small open addressing hash table mapping a key and pointer pair to an index, used while
+             *  grouping for locality.
+             *  @details Buckets are stamped with the generation they were written in, so the table is cleared in
+             *  constant time and its storage is reused across drains.
+             */
+            class GroupingTable
+            {
+                public:
+                    GroupingTable(const StorageAllocator<char>& allocator) : mBuckets(allocator), mGeneration(1), mCount(0), mMask(0) { }
+
+                    //! Removes every entry from the table.
+                    void clear(void) EASYDELEGATE_NOEXCEPT
+                    {
+                        ++mGeneration;
+                        mCount = 0;
+                    }
+
+                    /**
+                     *  @brief Looks up the given key, inserting the given value if it is not present.
+                     *  @param key The integer half of the key.
+                     *  @param pointer The pointer half of the key.
+                     *  @param value The value to insert if the key is not present.
+                     *  @param inserted Set to whether or not the value was inserted.
+                     *  @return The value stored against the key.
+                     */
+                    size_t findOrInsert(const size_t& key, const void* pointer, const size_t& value, bool& inserted)
+                    {
+                        if ((mCount + 1) * 2 > mBuckets.size())
+                            this->grow();
+
+                        size_t index = hash(key, pointer) & mMask;
+                        while (mBuckets[index].mGeneration == mGeneration)
+                        {
+                            if (mBuckets[index].mKey == key && mBuckets[index].mPointer == pointer)
+                            {
+                                inserted = false;
+                                return mBuckets[index].mValue;
+                            }
+
+                            index = (index + 1) & mMask;
+                        }
+
+                        Bucket& bucket = mBuckets[index];
+                        bucket.mKey = key;
+                        bucket.mPointer = pointer;
+                        bucket.mValue = value;
+                        bucket.mGeneration = mGeneration;
+                        ++mCount;
+
+                        inserted = true;
+                        return value;
+                    }
+
+                private:
+                    //! A single bucket of the table.
+                    struct Bucket
+                    {
+                        Bucket(void) EASYDELEGATE_NOEXCEPT : mKey(0), mPointer(NULL), mValue(0), mGeneration(0) { }
+
+                        size_t mKey;
+                        const void* mPointer;
+                        size_t mValue;
+                        //! The generation this bucket was written in. Buckets of older generations are empty.
+                        size_t mGeneration;
+                    };
+
+                    //! Mixes both halves of a key into a bucket index.
+                    static EASYDELEGATE_INLINE size_t hash(const size_t& key, const void* pointer) EASYDELEGATE_NOEXCEPT
+                    {
+                        const size_t mixed = (key ^ reinterpret_cast<size_t>(pointer)) * static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+                        return mixed ^ (mixed >> 29);
+                    }
+
+                    //! Doubles the number of buckets, reinserting every entry of the current generation.
+                    void grow(void)
+                    {
+                        BucketStorage previous(mBuckets.size() ? mBuckets.size() * 2 : 64, Bucket(), mBuckets.get_allocator());
+                        previous.swap(mBuckets);
+                        mMask = mBuckets.size() - 1;
+
+                        for (auto it = previous.begin(); it != previous.end(); ++it)
+                        {
+                            if (it->mGeneration != mGeneration)
+                                continue;
+
+                            size_t index = hash(it->mKey, it->mPointer) & mMask;
+                            while (mBuckets[index].mGeneration == mGeneration)
+                                index = (index + 1) & mMask;
+
+                            mBuckets[index] = *it;
+                        }
+                    }
+
+                    //! Storage for the buckets of the table.
+                    typedef std::vector<Bucket, StorageAllocator<Bucket> > BucketStorage;
+
+                    //! The buckets of the table. The count is always a power of two.
+                    BucketStorage mBuckets;
+                    //! The current generation. Only buckets of this generation hold entries.
+                    size_t mGeneration;
+                    //! The number of entries in the table.
+                    size_t mCount;
+                    //! Mask applied to hashes to select a bucket.
+                    size_t mMask;
+            };
+
+            /**
+             *  @brief Reorders every priority class that has changed since it was last grouped so that calls to
+             *  the same method, and then against the same this pointer, are adjacent. Cancelled entries are
+             *  discarded along the way.
+             *  @details Method groups are identified by the method hash recorded when each deferred caller was
+             *  pushed, so grouping only touches the queue's own storage rather than every deferred caller. Each
+             *  entry is assigned to a target bucket keyed by its method group and this pointer. Buckets are then
+             *  ordered by method group and the entries are placed with a counting sort, so grouping runs in time
+             *  linear to the length of the priority class and keeps calls against the same target in the order
+             *  they were pushed.
+             */
+            void group(void)
+            {
+                for (size_t priority = 0; priority < mQueues.size(); ++priority)
+                {
+                    if (mGrouped[priority])
+                        continue;
+
+                    PriorityClass& queue = mQueues[priority];
+
+                    mMethodHashes.clear();
+                    mTargets.clear();
+                    mTargetGroups.clear();
+                    mEntryTargets.clear();
+                    mGroupedEntries.clear();
+
+                    // Assign every live entry to a target bucket
+                    size_t groupCount = 0;
+                    for (auto it = queue.begin(); it != queue.end(); ++it)
+                    {
+                        const CallSlot& callSlot = mSlots[it->mSlot];
+
+                        if (!callSlot.mCaller)
+                        {
+                            this->releaseSlot(it->mSlot);
+                            continue;
+                        }
+
+                        bool inserted;
+                        const size_t methodGroup = mMethodHashes.findOrInsert(callSlot.mMethodHash, NULL, groupCount, inserted);
+
+                        if (inserted)
+                            ++groupCount;
+
+                        const size_t target = mTargets.findOrInsert(methodGroup, callSlot.mThisPointer, mTargetGroups.size(), inserted);
+
+                        if (inserted)
+                            mTargetGroups.push_back(methodGroup);
+
+                        mEntryTargets.push_back(target);
+                        mGroupedEntries.push_back(*it);
+                    }
+
+                    // Order target buckets by method group and find where each bucket starts
+                    mTargetStarts.assign(mTargetGroups.size() + 1, 0);
+                    mGroupStarts.assign(groupCount + 1, 0);
+
+                    for (auto it = mTargetGroups.begin(); it != mTargetGroups.end(); ++it)
+                        ++mGroupStarts[*it + 1];
+
+                    for (size_t methodGroup = 1; methodGroup < mGroupStarts.size(); ++methodGroup)
+                        mGroupStarts[methodGroup] += mGroupStarts[methodGroup - 1];
+
+                    mTargetOrder.resize(mTargetGroups.size());
+                    for (size_t target = 0; target < mTargetGroups.size(); ++target)
+                        mTargetOrder[mGroupStarts[mTargetGroups[target]]++] = target;
+
+                    for (auto it = mEntryTargets.begin(); it != mEntryTargets.end(); ++it)
+                        ++mTargetStarts[*it];
+
+                    size_t start = 0;
+                    for (auto it = mTargetOrder.begin(); it != mTargetOrder.end(); ++it)
+                    {
+                        const size_t count = mTargetStarts[*it];
+                        mTargetStarts[*it] = start;
+                        start += count;
+                    }
+
+                    // Place every entry into its bucket, preserving push order within a bucket
+                    mOrderedEntries.resize(mGroupedEntries.size(), QueueEntry(0, 0));
+                    for (size_t entry = 0; entry < mGroupedEntries.size(); ++entry)
+                        mOrderedEntries[mTargetStarts[mEntryTargets[entry]]++] = mGroupedEntries[entry];
+
+                    queue.assign(mOrderedEntries.begin(), mOrderedEntries.end());
+
+                    mGrouped[priority] = true;
+                    mInEntryOrder[priority] = false;
+                }
+            }
+
+            /**
+             *  @brief Removes and dispatches the most urgent pending deferred caller, skipping over any
+             *  that were cancelled.
+             *  @return A boolean representing whether or not a deferred caller was dispatched.
+             */
+            bool dispatchNext(void)
+            {
+                if (this->dispatchFrom(mOverdue))
+                    return true;
+
+                for (auto queue = mQueues.begin(); queue != mQueues.end(); ++queue)
+                    if (this->dispatchFrom(*queue))
+                        return true;
+
+                return false;
+            }
+
+            /**
+             *  @brief Removes and dispatches the first deferred caller of the given priority class, skipping over
+             *  any that were cancelled.
+             *  @param queue The priority class to dispatch from.
+             *  @return A boolean representing whether or not a deferred caller was dispatched.
+             */
+            bool dispatchFrom(PriorityClass& queue)
+            {
+                while (!queue.empty())
+                {
+                    const size_t slot = queue.front().mSlot;
+                    queue.pop_front();
+
+                    #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                        const uint64_t enqueueTicks = mSlots[slot].mEnqueueTicks;
+                    #endif
+
+                    // Release the slot before dispatching so that the queue remains consistent if the call
+                    // pushes more work or cancels calls
+                    std::unique_ptr<IDeferredCaller> caller(this->releaseSlot(slot));
+
+                    if (!caller)
+                        continue;
+
+                    --mSize;
+
+                    #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                        mQueueLatency.record(TimestampCounter::toDuration(TimestampCounter::read() - enqueueTicks));
+                    #endif
+
+                    caller->genericDispatch();
+                    return true;
+                }
+
+                return false;
+            }
+
+            /**
+             *  @brief Removes a slot from the this pointer index and returns it to the free list.
+             *  @param slot The index of the slot to release.
+             *  @return The deferred caller that was held in the slot, or NULL if it was cancelled.
+             */
+            IDeferredCaller* releaseSlot(const size_t& slot)
+            {
+                CallSlot& callSlot = mSlots[slot];
+                IDeferredCaller* caller = callSlot.mCaller;
+
+                if (callSlot.mThisPointer)
+                {
+                    auto indexed = mThisPointerIndex.find(callSlot.mThisPointer);
+                    IndexList& slots = indexed->second;
+
+                    // Swap the last indexed slot into our position so that removal is constant time
+                    const size_t moved = slots.back();
+                    slots[callSlot.mIndexPosition] = moved;
+                    mSlots[moved].mIndexPosition = callSlot.mIndexPosition;
+                    slots.pop_back();
+
+                    if (slots.empty())
+                        mThisPointerIndex.erase(indexed);
+                }
+
+                callSlot.mCaller = NULL;
+                callSlot.mThisPointer = NULL;
+                mFreeSlots.push_back(slot);
+
+                return caller;
+            }
+
+        #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+            // Private Members
+            private:
+                //! The allocations made for this queue's storage. Declared first, so it outlives every container.
+                AllocationCounter mStorageAllocations;
+        #endif
+
+        // Private Members
+        private:
+            //! The queued slots for each priority class.
+            std::vector<PriorityClass, StorageAllocator<PriorityClass> > mQueues;
+            //! Whether or not each priority class is unchanged since it was last grouped for locality.
+            std::vector<bool, StorageAllocator<bool> > mGrouped;
+            //! Whether or not each priority class is known to be in order of entry, as it has not been grouped since it was last empty.
+            std::vector<bool, StorageAllocator<bool> > mInEntryOrder;
+            //! The entries that waited in the most urgent priority class for the aging threshold, dispatched ahead of it.
+            PriorityClass mOverdue;
+
+            //! Storage for every queued deferred caller.
+            SlotStorage mSlots;
+            //! Slots that are not currently queued and may be reused.
+            IndexList mFreeSlots;
+            //! The slots of pending deferred callers, keyed by the this pointer they call against.
+            std::unordered_map<const void*, IndexList, std::hash<const void*>, std::equal_to<const void*>,
+            StorageAllocator<std::pair<const void* const, IndexList> > > mThisPointerIndex;
+
+            //! The number of drains a deferred caller may wait before being promoted. Zero disables aging.
+            const size_t mAgingThreshold;
+            //! The number of drains that have been started.
+            size_t mDrainSequence;
+            //! The total number of pending deferred callers, excluding cancelled ones.
+            size_t mSize;
+
+            //! Whether or not pending deferred callers are grouped for locality before draining.
+            bool mLocalityOrdering;
+            //! The method group for each method hash seen when grouping.
+            GroupingTable mMethodHashes;
+            //! The target bucket for each method group and this pointer seen when grouping.
+            GroupingTable mTargets;
+            //! The method group of each target bucket.
+            IndexList mTargetGroups;
+            //! The target buckets ordered by method group.
+            IndexList mTargetOrder;
+            //! Scratch storage for counting sorts when grouping.
+            IndexList mTargetStarts;
+            //! Scratch storage for counting sorts when grouping.
+            IndexList mGroupStarts;
+            //! The target bucket of each live entry when grouping.
+            IndexList mEntryTargets;
+            //! The live entries of the priority class being grouped.
+            EntryList mGroupedEntries;
+            //! The live entries of the priority class being grouped, in their grouped order.
+            EntryList mOrderedEntries;
+
+            //! Statistics gathered across budgeted drains.
+            DrainStatistics mStatistics;
+
+            #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                //! The time each dispatched deferred caller spent queued.
+                LatencyHistogram mQueueLatency;
+            #endif
+    };
+} // End NameSpace EasyDelegate
+#endif // _INCLUDE_EASYDELEGATE_DEFERREDQUEUE_HPP_
+#endif // EASYDELEGATE_NO_DEFERRED_CALLING
@@ -18,12 +18,42 @@
 
 #include "types.hpp"
 #include "exceptions.hpp"
+#include "statistics.hpp"
+#include "tracing.hpp"
+#include "accounting.hpp"
 
 namespace EasyDelegate
 {
     template <typename returnType, typename... parameters>
     class ITypedDelegate;
 
+    /**
+     *  @brief A delegate flattened into a function and the target it calls, as stored by a FrozenDelegateSet.
+     *  @details Calling mThunk with mTarget and the arguments does exactly what invoking the delegate would,
+     *  without the virtual call. Delegates that store a static function place it in the target directly, so
+     *  every such delegate of a signature shares a single thunk.
+     */
+    template <typename returnType, typename... parameters>
+    struct DelegateThunk
+    {
+        //! What a thunk is called with.
+        union Target
+        {
+            //! The static function called, for the thunk of a StaticDelegate.
+            StaticMethodPointer<returnType, parameters...> mFunction;
+            //! The delegate invoked, for any other thunk.
+            void* mObject;
+        };
+
+        //! The signature of a thunk.
+        typedef returnType (*ThunkType)(Target target, parameters... params);
+
+        //! The function invoking the target.
+        ThunkType mThunk;
+        //! The target passed to the thunk.
+        Target mTarget;
+    };
+
     /**
      *  @brief A type that can represent any delegate type, but it cannot be invoked
      *  without casting to a delegate type that knows the proper method signature.
@@ -41,6 +71,29 @@ namespace EasyDelegate
             //! A boolean representing whether or not this delegate is a member delegate.
             const bool mIsMemberDelegate;
 
+        #ifdef EASYDELEGATE_LISTENER_STATISTICS
+            // Public Methods
+            public:
+                /**
+                 *  @brief Returns the invocation statistics of this delegate.
+                 *  @return A reference to the statistics recorded whenever a DelegateSet or DeferredBroadcastCaller
+                 *  invokes this delegate.
+                 */
+                EASYDELEGATE_INLINE ListenerStatistics& getStatistics(void) EASYDELEGATE_NOEXCEPT { return mStatistics; }
+
+                /**
+                 *  @brief Returns the invocation statistics of this delegate.
+                 *  @return A const reference to the statistics recorded whenever a DelegateSet or DeferredBroadcastCaller
+                 *  invokes this delegate.
+                 */
+                EASYDELEGATE_INLINE const ListenerStatistics& getStatistics(void) const EASYDELEGATE_NOEXCEPT { return mStatistics; }
+
+            // Private Members
+            private:
+                //! The invocation statistics of this delegate.
+                ListenerStatistics mStatistics;
+        #endif
+
         // Protected Methods
         protected:
             /**
@@ -73,6 +126,7 @@ namespace EasyDelegate
              */
             StaticDelegate(const MethodPointer methodPointer) : ITypedDelegate<returnType, parameters...>(false), mMethodPointer(methodPointer)
             {
+                EASYDELEGATE_CHECK_CONSTRUCTION(methodPointer, InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
             }
 
             /**
@@ -81,6 +135,22 @@ namespace EasyDelegate
              */
             StaticDelegate(const StaticDelegate<returnType, parameters...>* other) : ITypedDelegate<returnType, parameters...>(false), mMethodPointer(other->mMethodPointer) { }
 
+            #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                /**
+                 *  @brief Allocates a StaticDelegate, recording it as ALLOCATION_STATIC_DELEGATE.
+                 *  @param size The size of the StaticDelegate.
+                 *  @return The allocated memory.
+                 */
+                static void* operator new(size_t size) { return AllocationAccounting::allocate(ALLOCATION_STATIC_DELEGATE, size); }
+
+                /**
+                 *  @brief Releases a StaticDelegate allocated by operator new.
+                 *  @param pointer The memory to release.
+                 *  @param size The size of the StaticDelegate.
+                 */
+                static void operator delete(void* pointer, size_t size) EASYDELEGATE_NOEXCEPT { AllocationAccounting::deallocate(ALLOCATION_STATIC_DELEGATE, pointer, size); }
+            #endif
+
             /**
              *  @brief Invokes the StaticDelegate.
              *  @param params Anything; It depends on the method signature specified in the template.
@@ -95,13 +165,48 @@ namespace EasyDelegate
             returnType invoke(parameters... params)
             {
                 assert(mMethodPointer);
+                EASYDELEGATE_CHECK_CALL(mMethodPointer, InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
 
-                if (!mMethodPointer)
-                    throw InvalidMethodPointerException();
+                return ((MethodPointer)mMethodPointer)(params...);
+            }
 
+            /**
+             *  @brief Invokes the StaticDelegate without checking its static method.
+             *  @param params Anything; It depends on the method signature specified in the template.
+             *  @return Anything; It depends on the function signature specified in the template.
+             *  @throw std::exception Potentially thrown by the method called by this StaticDelegate.
+             */
+            returnType invokeUnchecked(parameters... params)
+            {
+                assert(mMethodPointer);
                 return ((MethodPointer)mMethodPointer)(params...);
             }
 
+            /**
+             *  @brief Returns the failure invoking this StaticDelegate would report, without invoking it.
+             *  @return DELEGATE_ERROR_INVALID_METHOD_POINTER if the static method is NULL, otherwise DELEGATE_ERROR_NONE.
+             */
+            DelegateError getCallError(void) const EASYDELEGATE_NOEXCEPT
+            {
+                return mMethodPointer ? DELEGATE_ERROR_NONE : DELEGATE_ERROR_INVALID_METHOD_POINTER;
+            }
+
+            /**
+             *  @brief Returns this StaticDelegate flattened into a thunk and its target.
+             *  @return A thunk calling the static method directly, or one invoking this delegate if the static method is NULL,
+             *  so that the failure is still raised when it is called.
+             */
+            DelegateThunk<returnType, parameters...> getThunk(void) EASYDELEGATE_NOEXCEPT
+            {
+                if (!mMethodPointer)
+                    return ITypedDelegate<returnType, parameters...>::getThunk();
+
+                DelegateThunk<returnType, parameters...> result;
+                result.mThunk = &StaticDelegate::invokeThunk;
+                result.mTarget.mFunction = mMethodPointer;
+                return result;
+            }
+
             /**
              *  @brief Returns whether or not this StaticDelegate calls against the given this pointer.
              *  @param thisPointer A pointer referring to the object of interest.
@@ -111,6 +216,18 @@ namespace EasyDelegate
              */
 			EASYDELEGATE_INLINE bool hasThisPointer(const void *thisPointer) const EASYDELEGATE_NOEXCEPT { return false; }
 
+            /**
+             *  @brief Returns the static method this StaticDelegate calls.
+             *  @return A pointer to the static method.
+             */
+            EASYDELEGATE_INLINE MethodPointer getStaticMethodPointer(void) const EASYDELEGATE_NOEXCEPT { return mMethodPointer; }
+
+            /**
+             *  @brief Returns a hash of the static method this StaticDelegate calls.
+             *  @return A hash of the StaticDelegate type and the static method pointer.
+             */
+            EASYDELEGATE_INLINE size_t getMethodHash(void) const EASYDELEGATE_NOEXCEPT { return hashMethodPointer(&TypeTag<StaticDelegate>::sTag, mMethodPointer); }
+
             /**
              *  @brief Returns whether or not this StaticDelegate calls the given static method.
              *  @param methodPointer A pointer to the static method to be checked against.
@@ -181,6 +298,14 @@ namespace EasyDelegate
 
             //! Internal pointer to proc address to be called.
             const MethodPointer mMethodPointer;
+
+        // Private Methods
+        private:
+            //! The thunk returned by getThunk, calling the static method stored in the target.
+            static returnType invokeThunk(typename DelegateThunk<returnType, parameters...>::Target target, parameters... params)
+            {
+                return target.mFunction(params...);
+            }
     };
 
     /**
@@ -200,7 +325,10 @@ namespace EasyDelegate
              *  @brief Constructor accepting an std::function.
              *  @param function The std::function to call.
              */
-            FunctionDelegate(const FunctionType function) : ITypedDelegate<returnType, parameters...>(false), mFunction(function) { }
+            FunctionDelegate(const FunctionType function) : ITypedDelegate<returnType, parameters...>(false), mFunction(function)
+            {
+                EASYDELEGATE_CHECK_CONSTRUCTION(function, InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
+            }
 
             /**
              *  @brief Standard copy constructor.
@@ -209,6 +337,22 @@ namespace EasyDelegate
             FunctionDelegate(const FunctionDelegate<returnType, parameters...>* other) : ITypedDelegate<returnType, parameters...>(false),
             mFunction(other->mFunction) { }
 
+            #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                /**
+                 *  @brief Allocates a FunctionDelegate, recording it as ALLOCATION_FUNCTION_DELEGATE.
+                 *  @param size The size of the FunctionDelegate.
+                 *  @return The allocated memory.
+                 */
+                static void* operator new(size_t size) { return AllocationAccounting::allocate(ALLOCATION_FUNCTION_DELEGATE, size); }
+
+                /**
+                 *  @brief Releases a FunctionDelegate allocated by operator new.
+                 *  @param pointer The memory to release.
+                 *  @param size The size of the FunctionDelegate.
+                 */
+                static void operator delete(void* pointer, size_t size) EASYDELEGATE_NOEXCEPT { AllocationAccounting::deallocate(ALLOCATION_FUNCTION_DELEGATE, pointer, size); }
+            #endif
+
             /**
              *  @brief Invokes the FunctionDelegate.
              *  @param params Anything; It depends on the method signature specified in the template.
@@ -222,6 +366,27 @@ namespace EasyDelegate
                 return mFunction(params...);
             }
 
+            /**
+             *  @brief Returns the failure invoking this FunctionDelegate would report, without invoking it.
+             *  @return DELEGATE_ERROR_INVALID_METHOD_POINTER if the std::function is empty, otherwise DELEGATE_ERROR_NONE.
+             */
+            DelegateError getCallError(void) const EASYDELEGATE_NOEXCEPT
+            {
+                return mFunction ? DELEGATE_ERROR_NONE : DELEGATE_ERROR_INVALID_METHOD_POINTER;
+            }
+
+            /**
+             *  @brief Returns this FunctionDelegate flattened into a thunk and its target.
+             *  @return A thunk calling the std::function of this delegate without a virtual call.
+             */
+            DelegateThunk<returnType, parameters...> getThunk(void) EASYDELEGATE_NOEXCEPT
+            {
+                DelegateThunk<returnType, parameters...> result;
+                result.mThunk = &FunctionDelegate::invokeThunk;
+                result.mTarget.mObject = this;
+                return result;
+            }
+
             /**
              *  @brief Returns whether or not this FunctionDelegate calls against the given this pointer.
              *  @param thisPointer A pointer referring to the object of interest.
@@ -241,6 +406,12 @@ namespace EasyDelegate
         private:
             //! Internal pointer to proc address to be called.
             const FunctionType mFunction;
+
+            //! The thunk returned by getThunk, invoking the FunctionDelegate stored in the target.
+            static returnType invokeThunk(typename DelegateThunk<returnType, parameters...>::Target target, parameters... params)
+            {
+                return static_cast<FunctionDelegate*>(target.mObject)->FunctionDelegate::invoke(params...);
+            }
     };
 
     /**
@@ -266,7 +437,11 @@ namespace EasyDelegate
              *  behavior and/or segfault upon invocation in that case.
              */
             MemberDelegate(const MethodPointer methodPointer, classType* thisPointer) : mThisPointer(thisPointer),
-            mMethodPointer(methodPointer), ITypedDelegate<returnType, parameters...>(true) { }
+            mMethodPointer(methodPointer), ITypedDelegate<returnType, parameters...>(true)
+            {
+                EASYDELEGATE_CHECK_CONSTRUCTION(thisPointer, InvalidThisPointerException, DELEGATE_ERROR_INVALID_THIS_POINTER);
+                EASYDELEGATE_CHECK_CONSTRUCTION(methodPointer, InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
+            }
 
             /**
              *  @brief Standard copy constructor.
@@ -275,6 +450,22 @@ namespace EasyDelegate
             MemberDelegate(const MemberDelegate<classType, returnType, parameters...>* other) : mThisPointer(other->mThisPointer),
             mMethodPointer(other->mMethodPointer), ITypedDelegate<returnType, parameters...>(true) { }
 
+            #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                /**
+                 *  @brief Allocates a MemberDelegate, recording it as ALLOCATION_MEMBER_DELEGATE.
+                 *  @param size The size of the MemberDelegate.
+                 *  @return The allocated memory.
+                 */
+                static void* operator new(size_t size) { return AllocationAccounting::allocate(ALLOCATION_MEMBER_DELEGATE, size); }
+
+                /**
+                 *  @brief Releases a MemberDelegate allocated by operator new.
+                 *  @param pointer The memory to release.
+                 *  @param size The size of the MemberDelegate.
+                 */
+                static void operator delete(void* pointer, size_t size) EASYDELEGATE_NOEXCEPT { AllocationAccounting::deallocate(ALLOCATION_MEMBER_DELEGATE, pointer, size); }
+            #endif
+
             /**
              *  @brief Invoke the MemberDelegate.
              *  @param params Anything; It depends on the method signature specified in the template.
@@ -291,17 +482,54 @@ namespace EasyDelegate
             {
                 assert(mThisPointer);
                 assert(mMethodPointer);
+                EASYDELEGATE_CHECK_CALL(mThisPointer, InvalidThisPointerException, DELEGATE_ERROR_INVALID_THIS_POINTER);
+                EASYDELEGATE_CHECK_CALL(mMethodPointer, InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
 
-                if (!mThisPointer)
-                    throw InvalidThisPointerException();
+                classType *thisPointer = (classType*)mThisPointer;
+                return (thisPointer->*mMethodPointer)(params...);
+            }
 
-                if (!mMethodPointer)
-                    throw InvalidMethodPointerException();
+            /**
+             *  @brief Invoke the MemberDelegate without checking its this pointer or class member method.
+             *  @param params Anything; It depends on the method signature specified in the template.
+             *  @return Anything; It depends on the method signature specified in the template.
+             *  @throw std::exception Potentially thrown by the method called by this MemberDelegate.
+             */
+            returnType invokeUnchecked(parameters... params)
+            {
+                assert(mThisPointer);
+                assert(mMethodPointer);
 
                 classType *thisPointer = (classType*)mThisPointer;
                 return (thisPointer->*mMethodPointer)(params...);
             }
 
+            /**
+             *  @brief Returns the failure invoking this MemberDelegate would report, without invoking it.
+             *  @return DELEGATE_ERROR_INVALID_THIS_POINTER if the this pointer is NULL, DELEGATE_ERROR_INVALID_METHOD_POINTER
+             *  if the class member method is NULL, otherwise DELEGATE_ERROR_NONE.
+             */
+            DelegateError getCallError(void) const EASYDELEGATE_NOEXCEPT
+            {
+                if (!mThisPointer)
+                    return DELEGATE_ERROR_INVALID_THIS_POINTER;
+
+                return mMethodPointer ? DELEGATE_ERROR_NONE : DELEGATE_ERROR_INVALID_METHOD_POINTER;
+            }
+
+            /**
+             *  @brief Returns this MemberDelegate flattened into a thunk and its target.
+             *  @return A thunk invoking this delegate without a virtual call. The this pointer is still checked on every
+             *  call, as it may be changed after the delegate is frozen.
+             */
+            DelegateThunk<returnType, parameters...> getThunk(void) EASYDELEGATE_NOEXCEPT
+            {
+                DelegateThunk<returnType, parameters...> result;
+                result.mThunk = &MemberDelegate::invokeThunk;
+                result.mTarget.mObject = this;
+                return result;
+            }
+
             /**
              *  @brief Returns whether or not this MemberDelegate calls against the given this pointer.
              *  @param thisPointer A pointer referring to the object of interest.
@@ -310,6 +538,19 @@ namespace EasyDelegate
              */
 			EASYDELEGATE_INLINE bool hasThisPointer(const void* thisPointer) const EASYDELEGATE_NOEXCEPT { return mThisPointer == thisPointer; }
 
+            /**
+             *  @brief Returns the this pointer this MemberDelegate calls against.
+             *  @return A pointer to the object this MemberDelegate calls its class member method against.
+             */
+            EASYDELEGATE_INLINE const void* getThisPointer(void) const EASYDELEGATE_NOEXCEPT { return mThisPointer; }
+
+            /**
+             *  @brief Returns a hash of the class member method this MemberDelegate calls.
+             *  @return A hash of the MemberDelegate type and the class member method pointer, identical for every
+             *  MemberDelegate calling the same method whatever its this pointer.
+             */
+            EASYDELEGATE_INLINE size_t getMethodHash(void) const EASYDELEGATE_NOEXCEPT { return hashMethodPointer(&TypeTag<MemberDelegate>::sTag, mMethodPointer); }
+
             /**
              *  @brief Returns whether or not this MemberDelegate calls the given class member method pointer.
              *  @param methodPointer A pointer to a class member method to be checked against.
@@ -385,14 +626,46 @@ namespace EasyDelegate
             template <typename otherClass, typename otherReturn, typename... otherParams>
 			EASYDELEGATE_INLINE bool hasSameThisPointerAs(const MemberDelegate<otherClass, otherReturn, otherParams...>* other) const EASYDELEGATE_NOEXCEPT { return reinterpret_cast<void*>(mThisPointer) == reinterpret_cast<void*>(other->mThisPointer); }
 
-        // Public Members
-        public:
-            //! A pointer to the this object.
+            /**
+             *  @brief Changes the this pointer this MemberDelegate calls against.
+             *  @param thisPointer A pointer to the object instance to be considered this during invocation.
+             *  @throw EasyDelegate::InvalidThisPointerException Thrown with EASYDELEGATE_UNCHECKED defined when
+             *  the this pointer is NULL, in which case the this pointer is left unchanged.
+             */
+            void setThisPointer(classType* thisPointer)
+            {
+                EASYDELEGATE_CHECK_CONSTRUCTION(thisPointer, InvalidThisPointerException, DELEGATE_ERROR_INVALID_THIS_POINTER);
+                mThisPointer = thisPointer;
+            }
+
+            //! Every MemberDelegate may read the this pointer of another in hasSameThisPointerAs.
+            template <typename otherClass, typename otherReturn, typename... otherParams>
+            friend class MemberDelegate;
+
+        #ifdef EASYDELEGATE_UNCHECKED
+            // Private Members
+            private:
+        #else
+            // Public Members
+            public:
+        #endif
+            /**
+             *  @brief A pointer to the this object.
+             *  @note Private with EASYDELEGATE_UNCHECKED defined, as it is then never checked when invoked and can
+             *  only be changed through setThisPointer.
+             */
             classType* mThisPointer;
 
+        // Private Members
         private:
             //! An internal pointer to the proc address to be called.
             const MethodPointer mMethodPointer;
+
+            //! The thunk returned by getThunk, invoking the MemberDelegate stored in the target.
+            static returnType invokeThunk(typename DelegateThunk<returnType, parameters...>::Target target, parameters... params)
+            {
+                return static_cast<MemberDelegate*>(target.mObject)->MemberDelegate::invoke(params...);
+            }
     };
 
     /**
@@ -475,6 +748,35 @@ namespace EasyDelegate
              */
 			virtual bool hasThisPointer(const void* thisPointer) const EASYDELEGATE_NOEXCEPT = 0;
 
+            /**
+             *  @brief Returns the this pointer this delegate calls against.
+             *  @return A pointer to the object this delegate calls a member method against.
+             *  @note Always returns NULL unless this is a MemberDelegate.
+             */
+            virtual const void* getThisPointer(void) const EASYDELEGATE_NOEXCEPT { return NULL; }
+
+            /**
+             *  @brief Returns the static method this delegate calls.
+             *  @return A pointer to the static method.
+             *  @note Always returns NULL unless this is a StaticDelegate.
+             */
+            virtual StaticMethodPointerType getStaticMethodPointer(void) const EASYDELEGATE_NOEXCEPT { return NULL; }
+
+            /**
+             *  @brief Returns a hash of the method this delegate calls.
+             *  @return A hash that is identical for any two delegates of the same type calling the same method, so
+             *  that a member method can be identified without knowing its class.
+             *  @note Always returns 0 unless overridden, as the method called is unknown at this level.
+             */
+            virtual size_t getMethodHash(void) const EASYDELEGATE_NOEXCEPT { return 0; }
+
+            /**
+             *  @brief Returns the failure invoking this delegate would report, without invoking it.
+             *  @return DELEGATE_ERROR_NONE if the delegate can be invoked, otherwise the failure invoke would raise.
+             *  @note Returns DELEGATE_ERROR_NONE unless overridden.
+             */
+            virtual DelegateError getCallError(void) const EASYDELEGATE_NOEXCEPT { return DELEGATE_ERROR_NONE; }
+
             /**
              *  @brief Invoke the delegate with the given arguments and return a value, if any.
              *  @param params Anything; It depends on the function signature specified in the template.
@@ -488,6 +790,37 @@ namespace EasyDelegate
              *  assert if assertions are enabled.
              */
             virtual returnType invoke(parameters... params) = 0;
+
+            /**
+             *  @brief Invoke the delegate without checking whether it can be, as a set with the
+             *  UncheckedCallPolicy does after checking the delegate once when it was added.
+             *  @param params Anything; It depends on the function signature specified in the template.
+             *  @return Anything; It depends on the function signature specified in the template.
+             *  @throw std::exception Any exception can be potentially thrown by the function to be called.
+             *  @note Calls invoke unless overridden.
+             */
+            virtual returnType invokeUnchecked(parameters... params) { return this->invoke(params...); }
+
+            /**
+             *  @brief Returns this delegate flattened into a thunk and its target, as a FrozenDelegateSet stores it.
+             *  @return A thunk that behaves exactly as invoke when called with its target.
+             *  @note Returns a thunk making the virtual call to invoke unless overridden.
+             */
+            virtual DelegateThunk<returnType, parameters...> getThunk(void) EASYDELEGATE_NOEXCEPT
+            {
+                DelegateThunk<returnType, parameters...> result;
+                result.mThunk = &ITypedDelegate::invokeThunk;
+                result.mTarget.mObject = this;
+                return result;
+            }
+
+        // Private Methods
+        private:
+            //! The thunk returned by getThunk unless overridden, invoking the delegate stored in the target.
+            static returnType invokeThunk(typename DelegateThunk<returnType, parameters...>::Target target, parameters... params)
+            {
+                return static_cast<ITypedDelegate*>(target.mObject)->invoke(params...);
+            }
     };
 } // End NameSpace EasyDelegate
 #endif // _INCLUDE_EASYDELEGATE_DELEGATES_HPP_
@@ -190,7 +190,7 @@ namespace EasyDelegate
                 assert(mMethodPointer);
 
                 if (!mMethodPointer)
-                    throw InvalidMethodPointerException();
+                    EASYDELEGATE_RAISE(InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
 
                 va_list parameters;
                 va_start(parameters, paramCount);
@@ -228,7 +228,7 @@ namespace EasyDelegate
                 assert(mMethodPointer);
 
                 if (!mMethodPointer)
-                    throw InvalidMethodPointerException();
+                    EASYDELEGATE_RAISE(InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
 
                 // FIXME: We should call va_end before we return
                 return InvocationResolver<paramCount>::template ResolveSignature<returnType, paramOneType, paramTwoType, paramThreeType, paramFourType, paramFiveType>::call(this, parameters);
@@ -2,7 +2,7 @@
  *  @file delegateset.hpp
  *  @date 11/17/2016
  *  @version 3.0
- *  @brief Include file containing the definition for the DelegateSet class
+ *  @brief Include file containing the definition for the BasicDelegateSet class and its DelegateSet alias
  *  @author <a href="https://dx.no-ip.org">Robert MacGregor</a>
  *
  *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
@@ -15,25 +15,118 @@
 #include <vector>
 #include <functional>
 #include <unordered_set>
+#include <utility>          // std::forward
+#include <iterator>         // std::input_iterator_tag
+#include <type_traits>      // std::is_same
+#include <stddef.h>         // ptrdiff_t
 
 #include "types.hpp"
 #include "delegates.hpp"
 #include "deferredcallers.hpp"
+#include "slowlisteners.hpp"
+#include "histogram.hpp"
+#include "probes.hpp"
+#include "accounting.hpp"
+#include "combiners.hpp"
+#include "isolation.hpp"
+#include "policies.hpp"
 
 namespace EasyDelegate
 {
     /**
-     *  @brief A set of delegate instances that provides helper methods to invoke all
-     *  contained delegates.
-     *  @details The DelegateSet type can be described as a sink for specific event types.
-     *  Typical usage of this behavior would involve creating a typedef of a DelegateSet type
-     *  for a specific method signature which then has its own specialized typedefs to facilitate
-     *  the creation of StaticDelegate and MemberDelegate types that are compatible with instances
-     *  of this new specialized DelegateSet type.
+     *  @brief Instruments a single broadcast of a set for as long as it is in scope.
+     *  @details Fires the USDT broadcast probes with EASYDELEGATE_USDT_PROBES defined, records a trace span with
+     *  EASYDELEGATE_TRACING defined and times the broadcast into the set's histogram with
+     *  EASYDELEGATE_LATENCY_HISTOGRAMS defined. It is empty when none of them are.
+     */
+    class BroadcastInstrumentation
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the broadcast being instrumented.
+             *  @param name The name of the trace span, such as "DelegateSet::invoke".
+             *  @param delegateSet The set being invoked, which must provide size and getBroadcastLatency.
+             */
+            template <typename setType>
+            EASYDELEGATE_INLINE BroadcastInstrumentation(const char* name, const setType* delegateSet) EASYDELEGATE_NOEXCEPT
+            #if defined(EASYDELEGATE_USDT_PROBES) || defined(EASYDELEGATE_TRACING) || defined(EASYDELEGATE_LATENCY_HISTOGRAMS)
+                :
+                #ifdef EASYDELEGATE_USDT_PROBES
+                    mProbe(delegateSet, delegateSet->size())
+                    #if defined(EASYDELEGATE_TRACING) || defined(EASYDELEGATE_LATENCY_HISTOGRAMS)
+                        ,
+                    #endif
+                #endif
+                #ifdef EASYDELEGATE_TRACING
+                    mScope(name, delegateSet)
+                    #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                        ,
+                    #endif
+                #endif
+                #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                    mTimer(&delegateSet->getBroadcastLatency(), TimingSampler::sampleBroadcast())
+                #endif
+            #endif
+            {
+                (void)name;
+                (void)delegateSet;
+            }
+
+        // Private Members
+        private:
+            #ifdef EASYDELEGATE_USDT_PROBES
+                //! Fires the broadcast entry and return probes.
+                BroadcastProbe mProbe;
+            #endif
+
+            #ifdef EASYDELEGATE_TRACING
+                //! Records the broadcast as a trace span.
+                TraceScope mScope;
+            #endif
+
+            #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                //! Times the broadcast into the set's histogram.
+                LatencyTimer<ConcurrentLatencyHistogram> mTimer;
+            #endif
+    };
+
+    template <typename returnType, typename... parameters>
+    class FrozenDelegateSet;
+
+    template <typename signature, typename errorPolicy = CheckedCallPolicy>
+    class BasicLazyInvocation;
+
+    //! A BasicLazyInvocation with the default error policy, CheckedCallPolicy.
+    template <typename returnType, typename... parameters>
+    using LazyInvocation = BasicLazyInvocation<returnType(parameters...)>;
+
+    #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+        template <typename signature, typename errorPolicy = CheckedCallPolicy>
+        class BasicDeferredBroadcastCaller;
+
+        //! A BasicDeferredBroadcastCaller with the default error policy, CheckedCallPolicy.
+        template <typename returnType, typename... parameters>
+        using DeferredBroadcastCaller = BasicDeferredBroadcastCaller<returnType(parameters...)>;
+    #endif
+
+    /**
+     *  @brief The storage and instrumentation shared by every BasicDelegateSet with the same signature,
+     *  regardless of its policies.
+     *  @details This is the type DeferredBroadcastCaller and LazyInvocation refer to. It invokes nothing itself;
+     *  see BasicDelegateSet and DelegateSet. The std::vector holding the delegates is a protected base, so that
+     *  delegates can only be added and removed through the methods of the set, which validate and lock. The
+     *  delegates can be read with size, begin, end and operator [].
      */
     template <typename returnType, typename... parameters>
-    class DelegateSet : public std::vector<ITypedDelegate<returnType, parameters...> *>
+    class DelegateSetCore : protected std::vector<ITypedDelegate<returnType, parameters...> *, StorageAllocator<ITypedDelegate<returnType, parameters...> *> >
     {
+        #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+            //! Reads the delegates of the set it refers to.
+            template <typename signature, typename errorPolicy>
+            friend class BasicDeferredBroadcastCaller;
+        #endif
+
         public:
             //! Helper typedef to construct the function pointer signature from the template.
             typedef returnType (*delegateFuncPtr)(parameters...);
@@ -74,18 +167,245 @@ namespace EasyDelegate
                  *  delegate set.
                  */
                 typedef DeferredStaticCaller<returnType, parameters...> DeferredStaticCallerType;
+
+                /**
+                 *  @brief A helper typedef to a DeferredBroadcastCaller that invokes every delegate in a set
+                 *  of this type.
+                 */
+                typedef DeferredBroadcastCaller<returnType, parameters...> DeferredBroadcastCallerType;
             #endif
 
+            //! A helper typedef to the input range returned by invokeLazy.
+            typedef LazyInvocation<returnType, parameters...> LazyInvocationType;
+
             //! Helper typedef to an std::set that is compatible with the return types of delegates stored here.
             typedef std::vector<returnType> ReturnSetType;
 
+            //! Helper typedef referring to the container this set derives from.
+            typedef std::vector<StoredDelegateType*, StorageAllocator<StoredDelegateType*> > StorageType;
+            //! Helper typedef referring to an iterator over the delegates in the set, which cannot modify the set.
+            typedef typename StorageType::const_iterator const_iterator;
+
+            //! Returns the number of delegates in the set.
+            EASYDELEGATE_INLINE size_t size(void) const EASYDELEGATE_NOEXCEPT { return StorageType::size(); }
+
+            //! Returns whether or not the set holds no delegates.
+            EASYDELEGATE_INLINE bool empty(void) const EASYDELEGATE_NOEXCEPT { return StorageType::empty(); }
+
+            //! Returns an iterator to the first delegate in the set.
+            EASYDELEGATE_INLINE const_iterator begin(void) const EASYDELEGATE_NOEXCEPT { return StorageType::begin(); }
+
+            //! Returns an iterator past the last delegate in the set.
+            EASYDELEGATE_INLINE const_iterator end(void) const EASYDELEGATE_NOEXCEPT { return StorageType::end(); }
+
+            /**
+             *  @brief Returns the delegate at the given index.
+             *  @param index The index of the delegate, which must be less than size().
+             *  @return The delegate, which remains owned by the set.
+             */
+            EASYDELEGATE_INLINE StoredDelegateType* operator [](const size_t& index) const EASYDELEGATE_NOEXCEPT { return StorageType::operator[](index); }
+
+            #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                //! Standard constructor, binding the set's storage to its own allocation counter.
+                DelegateSetCore(void) : StorageType(StorageAllocator<StoredDelegateType*>(&mStorageAllocations)) { }
+            #endif
+
             //! Standard destructor.
-            ~DelegateSet(void)
+            ~DelegateSetCore(void)
             {
                 for (auto it = this->begin(); it != this->end(); it++)
                     delete *it;
+
+                #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                    // Release the storage now, as the counter it records against is destroyed before the base
+                    StorageType(this->get_allocator()).swap(*this);
+                #endif
             }
 
+            /**
+             *  @brief Invokes a single delegate of this set's type with the given arguments.
+             *  @details Every invocation made by a DelegateSet or a DeferredBroadcastCaller goes through this
+             *  method, so that per listener instrumentation has a single place to live. When no instrumentation
+             *  is enabled, this is exactly a call to errorPolicy::call, which is the delegate's invoke method by default.
+             *  @param delegateSet The DelegateSet invoking the delegate, or NULL if there is none.
+             *  @param delegateInstance The delegate to invoke.
+             *  @param arguments The arguments to forward to the delegate.
+             *  @return The value returned by the delegate.
+             *  @throw std::exception Any exception can be potentially thrown by the function the delegate calls.
+             */
+            template <typename errorPolicy = CheckedCallPolicy, typename... argumentTypes>
+            static EASYDELEGATE_INLINE returnType invokeDelegate(const DelegateSetCore* delegateSet, StoredDelegateType* delegateInstance, argumentTypes&&... arguments)
+            {
+                (void)delegateSet;
+
+                #ifdef EASYDELEGATE_USDT_PROBES
+                    ListenerProbe probe(delegateSet, delegateInstance);
+                #endif
+
+                #ifdef EASYDELEGATE_TRACING
+                    TraceScope scope("listener", delegateInstance);
+                #endif
+
+                #if defined(EASYDELEGATE_LISTENER_STATISTICS) || defined(EASYDELEGATE_SLOW_LISTENER_DETECTION)
+                    #ifdef EASYDELEGATE_LISTENER_STATISTICS
+                        ListenerCallTimer statisticsTimer(delegateInstance->getStatistics());
+                    #endif
+
+                    #ifdef EASYDELEGATE_SLOW_LISTENER_DETECTION
+                        SlowListenerTimer<StoredDelegateType> slowListenerTimer(SlowListenerDetector::select(delegateSet ? &delegateSet->mSlowListenerDetector : NULL),
+                        delegateInstance, delegateSet);
+                    #endif
+
+                    #ifdef EASYDELEGATE_NO_EXCEPTIONS
+                        return errorPolicy::call(delegateInstance, std::forward<argumentTypes>(arguments)...);
+                    #else
+                        try
+                        {
+                            return errorPolicy::call(delegateInstance, std::forward<argumentTypes>(arguments)...);
+                        }
+                        catch (...)
+                        {
+                            #ifdef EASYDELEGATE_LISTENER_STATISTICS
+                                statisticsTimer.setThrewException();
+                            #endif
+
+                            #ifdef EASYDELEGATE_SLOW_LISTENER_DETECTION
+                                slowListenerTimer.setThrewException();
+                            #endif
+
+                            throw;
+                        }
+                    #endif
+                #else
+                    return errorPolicy::call(delegateInstance, std::forward<argumentTypes>(arguments)...);
+                #endif
+            }
+
+            #ifdef EASYDELEGATE_SLOW_LISTENER_DETECTION
+                /**
+                 *  @brief Fires a callback whenever a single delegate invoked by this set takes longer than the given
+                 *  threshold. This overrides the global threshold for this set.
+                 *  @param threshold The latency threshold. Must be positive.
+                 *  @param callback The callback to fire with a description of the slow invocation. It must not throw.
+                 *  @note This must not be called while the set is being invoked.
+                 */
+                void setSlowListenerThreshold(const std::chrono::nanoseconds& threshold, const SlowListenerCallback& callback)
+                {
+                    mSlowListenerDetector.setThreshold(threshold, callback);
+                }
+
+                /**
+                 *  @brief Removes this set's slow listener threshold, so that the global threshold applies again.
+                 *  @note This must not be called while the set is being invoked.
+                 */
+                void clearSlowListenerThreshold(void) { mSlowListenerDetector.clearThreshold(); }
+
+                /**
+                 *  @brief Returns this set's own slow listener detector.
+                 *  @return A const reference to the detector, which is disabled unless a threshold was set on this set.
+                 */
+                EASYDELEGATE_INLINE const SlowListenerDetector& getSlowListenerDetector(void) const EASYDELEGATE_NOEXCEPT { return mSlowListenerDetector; }
+            #endif
+
+            #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                /**
+                 *  @brief Returns the histogram of the time taken by each full invocation of this set, including
+                 *  invocations by DeferredBroadcastCallers referring to this set.
+                 *  @return A reference to the histogram. Call getSnapshot on it to read percentiles.
+                 */
+                EASYDELEGATE_INLINE ConcurrentLatencyHistogram& getBroadcastLatency(void) const EASYDELEGATE_NOEXCEPT { return mBroadcastLatency; }
+            #endif
+
+            #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                /**
+                 *  @brief Returns the allocations made for this set's own storage.
+                 *  @return A snapshot of the live and peak storage of the set. The delegates it holds are
+                 *  accounted by kind through AllocationAccounting::getCounter.
+                 */
+                EASYDELEGATE_INLINE AllocationSnapshot getStorageAllocations(void) const EASYDELEGATE_NOEXCEPT { return mStorageAllocations.getSnapshot(); }
+            #endif
+
+        #ifdef EASYDELEGATE_SLOW_LISTENER_DETECTION
+            // Private Members
+            private:
+                //! This set's own slow listener detector, which falls back to the global detector while disabled.
+                SlowListenerDetector mSlowListenerDetector;
+        #endif
+
+        #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+            // Private Members
+            private:
+                //! The time taken by each full invocation of this set.
+                mutable ConcurrentLatencyHistogram mBroadcastLatency;
+        #endif
+
+        #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+            // Private Members
+            private:
+                //! The allocations made for this set's storage.
+                AllocationCounter mStorageAllocations;
+        #endif
+    };
+
+    /**
+     *  @brief A set of delegate instances that provides helper methods to invoke all
+     *  contained delegates, with its locking and error checking chosen at compile time.
+     *  @details The signature is given as a function type, such as int(const char*). The threading policy
+     *  decides which locks are held while the set is invoked and modified, and the error policy decides
+     *  whether delegates are checked when they are invoked or once when they are added. Both are resolved at
+     *  compile time, so a policy that does nothing costs nothing. DelegateSet is this type with the default
+     *  policies, SingleThreadedPolicy and CheckedCallPolicy.
+     *  @note Storage is always the std::vector DelegateSetCore derives from, which every invoke method, the
+     *  annotated sets and DeferredBroadcastCaller iterate directly. Ordering is provided by PriorityDelegateSet.
+     */
+    template <typename signature, typename threadingPolicy = SingleThreadedPolicy, typename errorPolicy = CheckedCallPolicy>
+    class BasicDelegateSet;
+
+    /**
+     *  @brief A set of delegate instances that provides helper methods to invoke all
+     *  contained delegates.
+     *  @details The DelegateSet type can be described as a sink for specific event types.
+     *  Typical usage of this behavior would involve creating a typedef of a DelegateSet type
+     *  for a specific method signature which then has its own specialized typedefs to facilitate
+     *  the creation of StaticDelegate and MemberDelegate types that are compatible with instances
+     *  of this new specialized DelegateSet type.
+     */
+    template <typename returnType, typename... parameters, typename threadingPolicy, typename errorPolicy>
+    class BasicDelegateSet<returnType(parameters...), threadingPolicy, errorPolicy> : public DelegateSetCore<returnType, parameters...>, private threadingPolicy
+    {
+        public:
+            //! Helper typedef referring to the policy free part of this set.
+            typedef DelegateSetCore<returnType, parameters...> DelegateSetCoreType;
+            //! Helper typedef referring to the threading policy of this set.
+            typedef threadingPolicy ThreadingPolicy;
+            //! Helper typedef referring to the error policy of this set.
+            typedef errorPolicy ErrorPolicy;
+
+            //! Helper typedef to construct the StaticDelegate signature from the template.
+            typedef typename DelegateSetCoreType::StoredDelegateType StoredDelegateType;
+            //! Helper typedef referring to a static function pointer.
+            typedef typename DelegateSetCoreType::StaticDelegateFuncPtr StaticDelegateFuncPtr;
+            //! Helper typedef referring to a member function pointer.
+            template <typename classType>
+            using MemberDelegateFuncPtr = returnType(classType::*)(parameters...);
+
+            #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+                //! A helper typedef to a DeferredBroadcastCaller that invokes every delegate in a set of this type.
+                typedef BasicDeferredBroadcastCaller<returnType(parameters...), errorPolicy> DeferredBroadcastCallerType;
+            #endif
+
+            //! A helper typedef to the input range returned by invokeLazy.
+            typedef BasicLazyInvocation<returnType(parameters...), errorPolicy> LazyInvocationType;
+
+            //! A helper typedef to the dispatch table returned by freeze.
+            typedef FrozenDelegateSet<returnType, parameters...> FrozenDelegateSetType;
+
+            /**
+             *  @brief Returns the threading policy of this set.
+             *  @return A const reference to the policy, such as a LockedPolicy whose mutex can be inspected.
+             */
+            EASYDELEGATE_INLINE const threadingPolicy& getThreadingPolicy(void) const EASYDELEGATE_NOEXCEPT { return *this; }
+
             /**
              *  @brief Invoke all delegates in the set, ignoring return values.
              *  @param params All other arguments that will be used as parameters to each delegate.
@@ -100,8 +420,12 @@ namespace EasyDelegate
              */
             EASYDELEGATE_INLINE void invoke(parameters... params) const
             {
+                const typename threadingPolicy::ReadGuard guard(*this);
+
+                const BroadcastInstrumentation instrumentation("DelegateSet::invoke", this);
+
                 for (auto it = this->begin(); it != this->end(); it++)
-                    (*it)->invoke(params...);
+                    DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, *it, params...);
             }
 
             /**
@@ -119,19 +443,395 @@ namespace EasyDelegate
              */
             EASYDELEGATE_INLINE void invoke(std::vector<returnType>& out, parameters... params) const
             {
+                const typename threadingPolicy::ReadGuard guard(*this);
+
+                const BroadcastInstrumentation instrumentation("DelegateSet::invoke", this);
+
+                for (auto it = this->begin(); it != this->end(); it++)
+                    out.push_back(DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, *it, params...));
+            }
+
+            /**
+             *  @brief Invoke all delegates in the set, folding each return value into a combiner as it is
+             *  produced rather than storing them.
+             *  @param combiner The combiner to fold return values into, such as a SumCombiner or an AnyCombiner.
+             *  It is copied, so one combiner may be used to start several invocations.
+             *  @param params All other arguments that will be used as parameters to each delegate.
+             *  @return The result of the combiner after every delegate has been invoked.
+             *  @throw InvalidMethodPointerException Thrown when assertions are disabled and either
+             *  a stored MemberDelegate or StaticDelegate type have a NULL function to call.
+             *  @throw InvalidThisPointerException Thrown when assertions are disabled and a stored
+             *  MemberDelegate is attempting to call against a NULL this pointer.
+             *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls.
+             *  @note The call will not throw an exception in any of the DelegateException cases but rather
+             *  assert if assertions are enabled.
+             *  @note If this throws an exception, the invocation of the set halts.
+             *  @note Every delegate is invoked, even once the result of the combiner can no longer change.
+             */
+            template <typename combinerType>
+            EASYDELEGATE_INLINE typename combinerType::ResultType invoke(combinerType combiner, parameters... params) const
+            {
+                const typename threadingPolicy::ReadGuard guard(*this);
+
+                const BroadcastInstrumentation instrumentation("DelegateSet::invoke", this);
+
+                for (auto it = this->begin(); it != this->end(); it++)
+                    combiner.combine(DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, *it, params...));
+
+                return combiner.getResult();
+            }
+
+            /**
+             *  @brief Invoke all delegates in the set, writing return values through an output iterator.
+             *  @param out The output iterator that all return values will be sequentially written to. Exactly
+             *  size() values are written.
+             *  @param params All other arguments that will be used as parameters to each delegate.
+             *  @return The output iterator after the last return value written.
+             *  @throw InvalidMethodPointerException Thrown when assertions are disabled and either
+             *  a stored MemberDelegate or StaticDelegate type have a NULL function to call.
+             *  @throw InvalidThisPointerException Thrown when assertions are disabled and a stored
+             *  MemberDelegate is attempting to call against a NULL this pointer.
+             *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls.
+             *  @note The call will not throw an exception in any of the DelegateException cases but rather
+             *  assert if assertions are enabled.
+             *  @note If this throws an exception, the invocation of the set halts.
+             */
+            template <typename outputIteratorType>
+            EASYDELEGATE_INLINE outputIteratorType invokeInto(outputIteratorType out, parameters... params) const
+            {
+                const typename threadingPolicy::ReadGuard guard(*this);
+
+                const BroadcastInstrumentation instrumentation("DelegateSet::invokeInto", this);
+
+                for (auto it = this->begin(); it != this->end(); it++)
+                {
+                    *out = DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, *it, params...);
+                    ++out;
+                }
+
+                return out;
+            }
+
+            /**
+             *  @brief Invoke all delegates in the set, storing return values in a caller provided buffer.
+             *  @param buffer The buffer that return values will be sequentially written to.
+             *  @param capacity The number of return values the buffer can hold.
+             *  @param params All other arguments that will be used as parameters to each delegate.
+             *  @return The number of delegates invoked. If this is greater than capacity, the buffer holds only the
+             *  return values of the first capacity delegates.
+             *  @throw InvalidMethodPointerException Thrown when assertions are disabled and either
+             *  a stored MemberDelegate or StaticDelegate type have a NULL function to call.
+             *  @throw InvalidThisPointerException Thrown when assertions are disabled and a stored
+             *  MemberDelegate is attempting to call against a NULL this pointer.
+             *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls.
+             *  @note The call will not throw an exception in any of the DelegateException cases but rather
+             *  assert if assertions are enabled.
+             *  @note If this throws an exception, the invocation of the set halts.
+             *  @note Every delegate is invoked even when the buffer is too small, so a buffer sized with size()
+             *  before the call never loses a return value.
+             */
+            EASYDELEGATE_INLINE size_t invokeIntoBuffer(returnType* buffer, const size_t& capacity, parameters... params) const
+            {
+                const typename threadingPolicy::ReadGuard guard(*this);
+
+                const BroadcastInstrumentation instrumentation("DelegateSet::invokeIntoBuffer", this);
+
+                size_t count = 0;
+                for (auto it = this->begin(); it != this->end(); it++, count++)
+                {
+                    if (count < capacity)
+                        buffer[count] = DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, *it, params...);
+                    else
+                        DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, *it, params...);
+                }
+
+                return count;
+            }
+
+            /**
+             *  @brief Invoke delegates in the set in order until the predicate accepts one's return value.
+             *  @param predicate A callable accepting a const returnType& and returning true when the event
+             *  has been handled. Delegates after the one whose return value it accepts are not invoked.
+             *  @param params All other arguments that will be used as parameters to each delegate.
+             *  @return The delegate that handled the event, or NULL if the predicate accepted no return value.
+             *  @throw InvalidMethodPointerException Thrown when assertions are disabled and either
+             *  a stored MemberDelegate or StaticDelegate type have a NULL function to call.
+             *  @throw InvalidThisPointerException Thrown when assertions are disabled and a stored
+             *  MemberDelegate is attempting to call against a NULL this pointer.
+             *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls.
+             *  @note The call will not throw an exception in any of the DelegateException cases but rather
+             *  assert if assertions are enabled.
+             *  @note If this throws an exception, the invocation of the set halts.
+             */
+            template <typename predicateType>
+            EASYDELEGATE_INLINE StoredDelegateType* invokeUntil(predicateType predicate, parameters... params) const
+            {
+                const typename threadingPolicy::ReadGuard guard(*this);
+
+                const BroadcastInstrumentation instrumentation("DelegateSet::invokeUntil", this);
+
                 for (auto it = this->begin(); it != this->end(); it++)
-                    out.push_back((*it)->invoke(params...));
+                    if (predicate(DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, *it, params...)))
+                        return *it;
+
+                return NULL;
+            }
+
+            /**
+             *  @brief Invoke delegates in the set in order until one returns a value that converts to true.
+             *  @param params All arguments that will be used as parameters to each delegate.
+             *  @return The delegate that handled the event, or NULL if no delegate did.
+             *  @throw InvalidMethodPointerException Thrown when assertions are disabled and either
+             *  a stored MemberDelegate or StaticDelegate type have a NULL function to call.
+             *  @throw InvalidThisPointerException Thrown when assertions are disabled and a stored
+             *  MemberDelegate is attempting to call against a NULL this pointer.
+             *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls.
+             *  @note The call will not throw an exception in any of the DelegateException cases but rather
+             *  assert if assertions are enabled.
+             *  @note If this throws an exception, the invocation of the set halts.
+             *  @note Delegates after the one that handled the event are not invoked.
+             */
+            EASYDELEGATE_INLINE StoredDelegateType* invokeUntilHandled(parameters... params) const
+            {
+                const typename threadingPolicy::ReadGuard guard(*this);
+
+                const BroadcastInstrumentation instrumentation("DelegateSet::invokeUntilHandled", this);
+
+                for (auto it = this->begin(); it != this->end(); it++)
+                    if (DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, *it, params...))
+                        return *it;
+
+                return NULL;
+            }
+
+            /**
+             *  @brief Invoke all delegates in the set, ignoring return values, recording any exception a delegate
+             *  throws and carrying on with the next delegate.
+             *  @param errors The buffer every exception is recorded in, along with the delegate that threw it.
+             *  @param params All other arguments that will be used as parameters to each delegate.
+             *  @return The number of delegates that threw or could not be invoked, including any the buffer had no
+             *  room to keep.
+             *  @note Delegates whose getCallError reports a failure are not invoked, and are recorded with that failure
+             *  instead of an exception. With EASYDELEGATE_NO_EXCEPTIONS defined, these are the only errors recorded.
+             *  @note invoke is unaffected by this method and still halts at the first exception.
+             */
+            EASYDELEGATE_INLINE size_t invokeIsolated(ListenerErrorBuffer& errors, parameters... params) const
+            {
+                const typename threadingPolicy::ReadGuard guard(*this);
+
+                const BroadcastInstrumentation instrumentation("DelegateSet::invokeIsolated", this);
+
+                size_t failureCount = 0;
+                for (size_t index = 0; index < this->size(); ++index)
+                {
+                    StoredDelegateType* current = this->operator[](index);
+
+                    #ifndef EASYDELEGATE_UNCHECKED
+                        const DelegateError error = current->getCallError();
+                        if (error != DELEGATE_ERROR_NONE)
+                        {
+                            errors.record(current, this, index, error, std::exception_ptr());
+                            ++failureCount;
+                            continue;
+                        }
+                    #endif
+
+                    #ifdef EASYDELEGATE_NO_EXCEPTIONS
+                        DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, current, params...);
+                    #else
+                        try
+                        {
+                            DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, current, params...);
+                        }
+                        catch (...)
+                        {
+                            errors.record(current, this, index, DELEGATE_ERROR_NONE, std::current_exception());
+                            ++failureCount;
+                        }
+                    #endif
+                }
+
+                return failureCount;
+            }
+
+            /**
+             *  @brief Invoke all delegates in the set, ignoring return values, stopping at the first delegate that
+             *  cannot be invoked rather than raising its failure.
+             *  @param params All arguments that will be used as parameters to each delegate.
+             *  @return DELEGATE_ERROR_NONE if every delegate was invoked, otherwise the failure of the first delegate
+             *  that could not be. The delegates before it have been invoked.
+             *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls.
+             *  @note This never raises a DelegateException or calls the DelegateFailure handler, so it is the way to
+             *  recover from NULL pointers with EASYDELEGATE_NO_EXCEPTIONS defined. With EASYDELEGATE_UNCHECKED defined,
+             *  no delegate can fail and this is equivalent to invoke.
+             */
+            EASYDELEGATE_INLINE DelegateError tryInvoke(parameters... params) const
+            {
+                const typename threadingPolicy::ReadGuard guard(*this);
+
+                const BroadcastInstrumentation instrumentation("DelegateSet::tryInvoke", this);
+
+                for (auto it = this->begin(); it != this->end(); it++)
+                {
+                    #ifndef EASYDELEGATE_UNCHECKED
+                        const DelegateError error = (*it)->getCallError();
+                        if (error != DELEGATE_ERROR_NONE)
+                            return error;
+                    #endif
+
+                    DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, *it, params...);
+                }
+
+                return DELEGATE_ERROR_NONE;
+            }
+
+            /**
+             *  @brief Invoke all delegates in the set, storing return values in out, stopping at the first delegate
+             *  that cannot be invoked rather than raising its failure.
+             *  @param out The std::vector that all return values will be sequentially written to.
+             *  @param params All other arguments that will be used as parameters to each delegate.
+             *  @return DELEGATE_ERROR_NONE if every delegate was invoked, otherwise the failure of the first delegate
+             *  that could not be. The return values of the delegates before it have been stored.
+             *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls.
+             */
+            EASYDELEGATE_INLINE DelegateError tryInvoke(std::vector<returnType>& out, parameters... params) const
+            {
+                const typename threadingPolicy::ReadGuard guard(*this);
+
+                const BroadcastInstrumentation instrumentation("DelegateSet::tryInvoke", this);
+
+                for (auto it = this->begin(); it != this->end(); it++)
+                {
+                    #ifndef EASYDELEGATE_UNCHECKED
+                        const DelegateError error = (*it)->getCallError();
+                        if (error != DELEGATE_ERROR_NONE)
+                            return error;
+                    #endif
+
+                    out.push_back(DelegateSetCoreType::template invokeDelegate<errorPolicy>(this, *it, params...));
+                }
+
+                return DELEGATE_ERROR_NONE;
+            }
+
+            #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+                /**
+                 *  @brief Creates a deferred caller that will later invoke every delegate in this set with the
+                 *  given arguments.
+                 *  @param params All other arguments that will be cached and used as parameters to each delegate.
+                 *  @return A new DeferredBroadcastCaller referring to this set. The delegates that are invoked are
+                 *  those in the set at the time of dispatch.
+                 *  @warning The returned deferred caller is only valid while this set remains valid. Ownership of
+                 *  the deferred caller is given to the caller of this method.
+                 *  @note The deferred caller reads the set without taking its ReadGuard, so this is only available
+                 *  with SingleThreadedPolicy. Other threading policies use deferInvokeSnapshot.
+                 */
+                DeferredBroadcastCallerType* deferInvoke(parameters... params) const
+                {
+                    static_assert(std::is_same<threadingPolicy, SingleThreadedPolicy>::value,
+                    "deferInvoke reads the set without its lock; use deferInvokeSnapshot with this threading policy");
+
+                    return new DeferredBroadcastCallerType(*this, params...);
+                }
+
+                /**
+                 *  @brief Creates a deferred caller that will later invoke every delegate currently in this set with
+                 *  the given arguments.
+                 *  @param params All other arguments that will be cached and used as parameters to each delegate.
+                 *  @return A new DeferredBroadcastCaller holding a snapshot of the delegates in this set. Delegates
+                 *  added to the set afterwards will not be invoked.
+                 *  @warning The delegates in the snapshot must remain valid until the deferred caller is dispatched.
+                 *  Ownership of the deferred caller is given to the caller of this method.
+                 */
+                DeferredBroadcastCallerType* deferInvokeSnapshot(parameters... params) const
+                {
+                    const typename threadingPolicy::ReadGuard guard(*this);
+
+                    #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                        return new DeferredBroadcastCallerType(std::vector<StoredDelegateType*>(this->begin(), this->end()), params...);
+                    #else
+                        return new DeferredBroadcastCallerType(static_cast<const std::vector<StoredDelegateType*>&>(*this), params...);
+                    #endif
+                }
+            #endif
+
+            /**
+             *  @brief Creates an input range that invokes the delegates in this set one at a time as it is
+             *  iterated, yielding each return value.
+             *  @param params All other arguments that will be cached and used as parameters to each delegate.
+             *  @return A LazyInvocation over this set. No delegate is invoked until its begin method is called.
+             *  @warning The range is only valid while this set remains valid, and the set must not be modified
+             *  while the range is being iterated.
+             *  @note The range reads the set without taking its ReadGuard, so this is only available with
+             *  SingleThreadedPolicy.
+             */
+            EASYDELEGATE_INLINE LazyInvocationType invokeLazy(parameters... params) const
+            {
+                static_assert(std::is_same<threadingPolicy, SingleThreadedPolicy>::value,
+                "invokeLazy reads the set without its lock and is unavailable with this threading policy");
+
+                return LazyInvocationType(*this, params...);
             }
 
+
+            #ifdef EASYDELEGATE_LISTENER_STATISTICS
+                /**
+                 *  @brief Calls the given callback with the invocation statistics of every delegate in the set, in
+                 *  the order the delegates are stored.
+                 *  @param callback A callable accepting a const StoredDelegateType* and a
+                 *  const ListenerStatisticsSnapshot&.
+                 */
+                template <typename callbackType>
+                void forEachStatistics(callbackType callback) const
+                {
+                    const typename threadingPolicy::ReadGuard guard(*this);
+
+                    for (auto it = this->begin(); it != this->end(); it++)
+                        callback(static_cast<const StoredDelegateType*>(*it), (*it)->getStatistics().getSnapshot());
+                }
+
+                //! Resets the invocation statistics of every delegate in the set.
+                void resetStatistics(void)
+                {
+                    const typename threadingPolicy::ReadGuard guard(*this);
+
+                    for (auto it = this->begin(); it != this->end(); it++)
+                        (*it)->getStatistics().reset();
+                }
+            #endif
+
             /**
              *  @brief Pushes a delegate instance to the end of the set.
              *  @param delegateInstance The delegate instance to the pushed onto the set.
+             *  @throw DelegateException Thrown by errorPolicy::validate when it rejects the delegate, which is then
+             *  not added and remains owned by the caller. CheckedCallPolicy never rejects a delegate.
              *  @warning Ownership of the delegate will be given to the set, therefore the
              *  given delegate should not be deleted manually.
              */
             EASYDELEGATE_INLINE void operator +=(StoredDelegateType* delegateInstance)
             {
-                this->push_back(delegateInstance);
+                errorPolicy::validate(delegateInstance);
+
+                const typename threadingPolicy::WriteGuard guard(*this);
+
+                #ifdef EASYDELEGATE_USDT_PROBES
+                    EASYDELEGATE_PROBE4(add, this, delegateInstance, delegateInstance->getThisPointer(),
+                    reinterpret_cast<const void*>(delegateInstance->getStaticMethodPointer()));
+                #endif
+
+                StorageType::push_back(delegateInstance);
+            }
+
+            /**
+             *  @brief Pushes a delegate instance to the end of the set, exactly as operator += does.
+             *  @param delegateInstance The delegate instance to the pushed onto the set.
+             *  @throw DelegateException Thrown by errorPolicy::validate when it rejects the delegate, which is then
+             *  not added and remains owned by the caller.
+             *  @note Kept for code written against the std::vector the set derives from, which is no longer public.
+             */
+            EASYDELEGATE_INLINE void push_back(StoredDelegateType* delegateInstance)
+            {
+                *this += delegateInstance;
             }
 
             /**
@@ -149,6 +849,8 @@ namespace EasyDelegate
             template <typename className>
             EASYDELEGATE_INLINE void removeDelegateByMethod(const MemberDelegateFuncPtr<className> method, const bool& deleteInstances=true, std::vector<StoredDelegateType *>* out=NULL)
             {
+                const typename threadingPolicy::WriteGuard guard(*this);
+
                 std::vector<size_t> erasedIndices;
 
                 for (size_t currentIndex = 0; currentIndex < this->size(); ++currentIndex)
@@ -157,6 +859,10 @@ namespace EasyDelegate
 
                     if (current->callsMethod(method))
                     {
+                        #ifdef EASYDELEGATE_USDT_PROBES
+                            EASYDELEGATE_PROBE2(remove, this, current);
+                        #endif
+
                         if (deleteInstances)
                             delete current;
                         else if (out)
@@ -184,6 +890,8 @@ namespace EasyDelegate
              */
             void removeDelegateByMethod(StaticDelegateFuncPtr methodPointer, const bool& deleteInstances=true, std::vector<StoredDelegateType *>* out=NULL)
             {
+                const typename threadingPolicy::WriteGuard guard(*this);
+
                 std::vector<size_t> erasedIndices;
 
                 for (size_t currentIndex = 0; currentIndex < this->size(); ++currentIndex)
@@ -192,6 +900,10 @@ namespace EasyDelegate
 
                     if (current->callsMethod(methodPointer))
                     {
+                        #ifdef EASYDELEGATE_USDT_PROBES
+                            EASYDELEGATE_PROBE2(remove, this, current);
+                        #endif
+
                         if (deleteInstances)
                             delete current;
                         else if (out)
@@ -219,6 +931,8 @@ namespace EasyDelegate
              */
             void removeDelegateByThisPointer(const void* thisPtr, const bool& deleteInstances=true, std::vector<StoredDelegateType *>* out=NULL)
             {
+                const typename threadingPolicy::WriteGuard guard(*this);
+
                 std::vector<size_t> erasedIndices;
 
                 for (size_t currentIndex = 0; currentIndex < this->size(); ++currentIndex)
@@ -227,6 +941,10 @@ namespace EasyDelegate
 
                     if (current->mIsMemberDelegate && current->hasThisPointer(thisPtr))
                     {
+                        #ifdef EASYDELEGATE_USDT_PROBES
+                            EASYDELEGATE_PROBE2(remove, this, current);
+                        #endif
+
                         if (deleteInstances)
                             delete current;
                         else if (out)
@@ -250,12 +968,18 @@ namespace EasyDelegate
              */
             StoredDelegateType* removeDelegate(StoredDelegateType* instance, const bool& deleteInstance=true)
             {
+                const typename threadingPolicy::WriteGuard guard(*this);
+
                 for (auto it = this->begin(); it != this->end(); it++)
                 {
                     StoredDelegateType* current = *it;
 
                     if (current == instance)
                     {
+                        #ifdef EASYDELEGATE_USDT_PROBES
+                            EASYDELEGATE_PROBE2(remove, this, current);
+                        #endif
+
                         if (deleteInstance)
                             delete current;
 
@@ -270,6 +994,618 @@ namespace EasyDelegate
 
                 return NULL;
             }
+
+            /**
+             *  @brief Moves every delegate in the set into an immutable dispatch table, leaving the set empty.
+             *  @return A FrozenDelegateSet invoking the delegates in the same order. Call its thaw method to move them
+             *  back into a mutable set.
+             *  @note Ownership of the delegates is given to the returned FrozenDelegateSet.
+             */
+            FrozenDelegateSetType freeze(void)
+            {
+                const typename threadingPolicy::WriteGuard guard(*this);
+
+                FrozenDelegateSetType frozen(this->begin(), this->end());
+                StorageType::clear();
+                return frozen;
+            }
+
+            /**
+             *  @brief Removes every delegate from the set without deleting them.
+             *  @warning Ownership of the delegates is not given back, so they leak unless they are tracked elsewhere.
+             */
+            void clear(void) EASYDELEGATE_NOEXCEPT
+            {
+                const typename threadingPolicy::WriteGuard guard(*this);
+                StorageType::clear();
+            }
+
+        // Protected Methods
+        protected:
+            //! Helper typedef referring to the container the delegates are stored in.
+            typedef typename DelegateSetCoreType::StorageType StorageType;
+    };
+
+    /**
+     *  @brief A DelegateSet taking no locks and checking each delegate when it is invoked.
+     *  @details Use BasicDelegateSet directly to choose other policies.
+     */
+    template <typename returnType, typename... parameters>
+    using DelegateSet = BasicDelegateSet<returnType(parameters...)>;
+
+    /**
+     *  @brief An immutable dispatch table holding the delegates of a DelegateSet, as returned by freeze.
+     *  @details Each delegate is flattened into a DelegateThunk when the table is built, so invoking the table
+     *  calls each thunk directly rather than making a virtual call through the delegate. The targets are packed
+     *  into a single array, and consecutive delegates sharing a thunk, such as any run of StaticDelegates, are
+     *  grouped so that the thunk is loaded once per run. Delegates are invoked in the order they were in the set.
+     *  Nothing can be added or removed, so the table keeps no bookkeeping for it, and as invoking never modifies
+     *  the table it may be invoked from any number of threads at once.
+     *  @note With EASYDELEGATE_LISTENER_STATISTICS, EASYDELEGATE_SLOW_LISTENER_DETECTION, EASYDELEGATE_TRACING or
+     *  EASYDELEGATE_USDT_PROBES defined, each delegate is invoked through DelegateSetCore::invokeDelegate instead of
+     *  its thunk, so that the per listener instrumentation still applies.
+     */
+    template <typename returnType, typename... parameters>
+    class FrozenDelegateSet
+    {
+        // Public Methods
+        public:
+            //! Helper typedef referring to the delegate type stored in this table.
+            typedef ITypedDelegate<returnType, parameters...> StoredDelegateType;
+            //! Helper typedef referring to the thunk each delegate is flattened into.
+            typedef DelegateThunk<returnType, parameters...> DelegateThunkType;
+            //! Helper typedef to an std::vector that is compatible with the return types of delegates stored here.
+            typedef std::vector<returnType> ReturnSetType;
+
+            //! Standard constructor, creating an empty table.
+            FrozenDelegateSet(void) { }
+
+            /**
+             *  @brief Constructor accepting the delegates to hold.
+             *  @param first An iterator to the first StoredDelegateType pointer.
+             *  @param last An iterator past the last StoredDelegateType pointer.
+             *  @warning Ownership of the delegates is given to the table once constructed, therefore they
+             *  should not be deleted manually.
+             */
+            template <typename iteratorType>
+            FrozenDelegateSet(iteratorType first, iteratorType last) : mDelegates(first, last)
+            {
+                this->build();
+            }
+
+            /**
+             *  @brief Move constructor, taking the delegates of another table and leaving it empty.
+             *  @param other The table to take the delegates of.
+             */
+            FrozenDelegateSet(FrozenDelegateSet&& other) EASYDELEGATE_NOEXCEPT : mDelegates(std::move(other.mDelegates)),
+            mTargets(std::move(other.mTargets)), mRuns(std::move(other.mRuns))
+            {
+                other.mDelegates.clear();
+                other.mTargets.clear();
+                other.mRuns.clear();
+            }
+
+            /**
+             *  @brief Move assignment, deleting the delegates of this table and taking those of another.
+             *  @param other The table to take the delegates of.
+             *  @return A reference to this table.
+             */
+            FrozenDelegateSet& operator =(FrozenDelegateSet&& other) EASYDELEGATE_NOEXCEPT
+            {
+                if (&other != this)
+                {
+                    for (auto it = mDelegates.begin(); it != mDelegates.end(); it++)
+                        delete *it;
+
+                    mDelegates.swap(other.mDelegates);
+                    mTargets.swap(other.mTargets);
+                    mRuns.swap(other.mRuns);
+
+                    other.mDelegates.clear();
+                    other.mTargets.clear();
+                    other.mRuns.clear();
+                }
+
+                return *this;
+            }
+
+            //! Standard destructor, deleting every delegate held.
+            ~FrozenDelegateSet(void)
+            {
+                for (auto it = mDelegates.begin(); it != mDelegates.end(); it++)
+                    delete *it;
+            }
+
+            /**
+             *  @brief Invoke all delegates in the table, ignoring return values.
+             *  @param params All arguments that will be used as parameters to each delegate.
+             *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls,
+             *  including the DelegateExceptions of delegates that cannot be invoked.
+             *  @note If this throws an exception, the invocation of the table halts.
+             */
+            EASYDELEGATE_INLINE void invoke(parameters... params) const
+            {
+                const BroadcastInstrumentation instrumentation("FrozenDelegateSet::invoke", this);
+
+                #if defined(EASYDELEGATE_LISTENER_STATISTICS) || defined(EASYDELEGATE_SLOW_LISTENER_DETECTION) || defined(EASYDELEGATE_TRACING) || defined(EASYDELEGATE_USDT_PROBES)
+                    for (auto it = mDelegates.begin(); it != mDelegates.end(); it++)
+                        DelegateSetCore<returnType, parameters...>::invokeDelegate(NULL, *it, params...);
+                #else
+                    const TargetType* target = mTargets.data();
+                    for (auto run = mRuns.begin(); run != mRuns.end(); run++)
+                    {
+                        const typename DelegateThunkType::ThunkType thunk = run->mThunk;
+                        for (const TargetType* end = mTargets.data() + run->mEnd; target != end; ++target)
+                            thunk(*target, params...);
+                    }
+                #endif
+            }
+
+            /**
+             *  @brief Invoke all delegates in the table, storing return values in out.
+             *  @param out The std::vector that all return values will be sequentially written to.
+             *  @param params All other arguments that will be used as parameters to each delegate.
+             *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls,
+             *  including the DelegateExceptions of delegates that cannot be invoked.
+             *  @note If this throws an exception, the invocation of the table halts.
+             */
+            EASYDELEGATE_INLINE void invoke(std::vector<returnType>& out, parameters... params) const
+            {
+                const BroadcastInstrumentation instrumentation("FrozenDelegateSet::invoke", this);
+
+                #if defined(EASYDELEGATE_LISTENER_STATISTICS) || defined(EASYDELEGATE_SLOW_LISTENER_DETECTION) || defined(EASYDELEGATE_TRACING) || defined(EASYDELEGATE_USDT_PROBES)
+                    for (auto it = mDelegates.begin(); it != mDelegates.end(); it++)
+                        out.push_back(DelegateSetCore<returnType, parameters...>::invokeDelegate(NULL, *it, params...));
+                #else
+                    const TargetType* target = mTargets.data();
+                    for (auto run = mRuns.begin(); run != mRuns.end(); run++)
+                    {
+                        const typename DelegateThunkType::ThunkType thunk = run->mThunk;
+                        for (const TargetType* end = mTargets.data() + run->mEnd; target != end; ++target)
+                            out.push_back(thunk(*target, params...));
+                    }
+                #endif
+            }
+
+            /**
+             *  @brief Moves every delegate in the table into the given mutable set with its operator +=, leaving the
+             *  table empty.
+             *  @param set The set to add the delegates to, such as a DelegateSet or a PriorityDelegateSet.
+             *  @throw DelegateException Thrown when the error policy of the set rejects a delegate. That delegate and
+             *  those after it remain in the table.
+             */
+            template <typename setType>
+            void thaw(setType& set)
+            {
+                size_t movedCount = 0;
+
+                #ifdef EASYDELEGATE_NO_EXCEPTIONS
+                    for (; movedCount < mDelegates.size(); ++movedCount)
+                        set += mDelegates[movedCount];
+                #else
+                    try
+                    {
+                        for (; movedCount < mDelegates.size(); ++movedCount)
+                            set += mDelegates[movedCount];
+                    }
+                    catch (...)
+                    {
+                        this->release(movedCount);
+                        throw;
+                    }
+                #endif
+
+                this->release(movedCount);
+            }
+
+            //! Returns the number of delegates in the table.
+            EASYDELEGATE_INLINE size_t size(void) const EASYDELEGATE_NOEXCEPT { return mDelegates.size(); }
+
+            //! Returns whether or not the table holds no delegates.
+            EASYDELEGATE_INLINE bool empty(void) const EASYDELEGATE_NOEXCEPT { return mDelegates.empty(); }
+
+            //! Returns the number of runs of consecutive delegates sharing a thunk.
+            EASYDELEGATE_INLINE size_t getRunCount(void) const EASYDELEGATE_NOEXCEPT { return mRuns.size(); }
+
+            /**
+             *  @brief Returns a delegate held by the table.
+             *  @param index The index of the delegate, less than size().
+             *  @return A pointer to the delegate, still owned by the table.
+             */
+            EASYDELEGATE_INLINE StoredDelegateType* getDelegate(const size_t& index) const EASYDELEGATE_NOEXCEPT { return mDelegates[index]; }
+
+            #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                /**
+                 *  @brief Returns the histogram of the time taken by each full invocation of this table.
+                 *  @return A reference to the histogram. Call getSnapshot on it to read percentiles.
+                 */
+                EASYDELEGATE_INLINE ConcurrentLatencyHistogram& getBroadcastLatency(void) const EASYDELEGATE_NOEXCEPT { return mBroadcastLatency; }
+            #endif
+
+        // Private Methods
+        private:
+            //! Helper typedef referring to the target each thunk is called with.
+            typedef typename DelegateThunkType::Target TargetType;
+
+            //! A run of consecutive delegates sharing a thunk, ending at mEnd and starting where the previous run ends.
+            struct Run
+            {
+                //! The thunk shared by the run.
+                typename DelegateThunkType::ThunkType mThunk;
+                //! The index past the last target of the run.
+                size_t mEnd;
+            };
+
+            //! Flattens every delegate into the packed targets and runs of thunks.
+            void build(void)
+            {
+                mTargets.clear();
+                mRuns.clear();
+                mTargets.reserve(mDelegates.size());
+
+                for (auto it = mDelegates.begin(); it != mDelegates.end(); it++)
+                {
+                    const DelegateThunkType thunk = (*it)->getThunk();
+
+                    if (mRuns.empty() || mRuns.back().mThunk != thunk.mThunk)
+                    {
+                        const Run run = { thunk.mThunk, mTargets.size() };
+                        mRuns.push_back(run);
+                    }
+
+                    mTargets.push_back(thunk.mTarget);
+                    ++mRuns.back().mEnd;
+                }
+            }
+
+            //! Forgets the first count delegates, whose ownership has been given elsewhere, and rebuilds the table.
+            void release(const size_t& count)
+            {
+                mDelegates.erase(mDelegates.begin(), mDelegates.begin() + count);
+                this->build();
+            }
+
+        // Private Members
+        private:
+            //! The delegates held, in invocation order.
+            std::vector<StoredDelegateType*> mDelegates;
+            //! The target of each delegate, in invocation order.
+            std::vector<TargetType> mTargets;
+            //! The runs of consecutive delegates sharing a thunk, in invocation order.
+            std::vector<Run> mRuns;
+
+            #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                //! The time taken by each full invocation of this table.
+                mutable ConcurrentLatencyHistogram mBroadcastLatency;
+            #endif
+    };
+
+
+    #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+        /**
+         *  @brief A deferred caller that invokes every delegate in a DelegateSet.
+         *  @details The DeferredBroadcastCaller stores its parameter list once in an std::tuple,
+         *  shared by every delegate it invokes, rather than requiring a deferred caller per delegate.
+         *  It either refers to a DelegateSet, invoking whichever delegates are in the set at the time
+         *  of dispatch, or holds a snapshot of the delegates taken when it was constructed. Each delegate
+         *  is invoked under the error policy of the set that created it. DeferredBroadcastCaller is this
+         *  type with CheckedCallPolicy.
+         */
+        template <typename returnType, typename... parameters, typename errorPolicy>
+        class BasicDeferredBroadcastCaller<returnType(parameters...), errorPolicy> : public ITypedDeferredCaller<void>
+        {
+            // Public Methods
+            public:
+                //! Helper typedef referring to the part of a DelegateSet with any policies that this deferred caller invokes.
+                typedef DelegateSetCore<returnType, parameters...> DelegateSetType;
+                //! Helper typedef referring to the delegate type this deferred caller invokes.
+                typedef ITypedDelegate<returnType, parameters...> StoredDelegateType;
+                //! Helper typedef referring to a snapshot of the delegates in a DelegateSet.
+                typedef std::vector<StoredDelegateType*> SnapshotType;
+                //! Helper typedef referring to the container the delegates are invoked from.
+                typedef typename DelegateSetType::StorageType StorageType;
+
+                /**
+                 *  @brief Constructor accepting a DelegateSet to invoke upon dispatch.
+                 *  @param delegateSet The DelegateSet whose delegates will be invoked.
+                 *  @param params The parameter list to use when later dispatching this DeferredBroadcastCaller.
+                 *  @warning The DeferredBroadcastCaller is only valid while the given DelegateSet remains valid. The
+                 *  set is read without taking any lock, so a set with a threading policy other than
+                 *  SingleThreadedPolicy is deferred with BasicDelegateSet::deferInvokeSnapshot instead.
+                 */
+                BasicDeferredBroadcastCaller(const DelegateSetType& delegateSet, parameters... params) : mDelegateSet(&delegateSet),
+                mParameters(params...) { }
+
+                /**
+                 *  @brief Constructor accepting a snapshot of delegates to invoke upon dispatch.
+                 *  @param snapshot The delegates to be invoked. The list is copied, but the delegates are not.
+                 *  @param params The parameter list to use when later dispatching this DeferredBroadcastCaller.
+                 *  @warning The DeferredBroadcastCaller is only valid while all delegates in the snapshot remain valid.
+                 */
+                BasicDeferredBroadcastCaller(const SnapshotType& snapshot, parameters... params) : mDelegateSet(NULL), mSnapshot(snapshot.begin(), snapshot.end()),
+                mParameters(params...) { }
+
+                #ifdef EASYDELEGATE_ALLOCATION_ACCOUNTING
+                    /**
+                     *  @brief Allocates a DeferredBroadcastCaller, recording it as ALLOCATION_DEFERRED_BROADCAST_CALLER.
+                     *  @param size The size of the DeferredBroadcastCaller.
+                     *  @return The allocated memory.
+                     */
+                    static void* operator new(size_t size) { return AllocationAccounting::allocate(ALLOCATION_DEFERRED_BROADCAST_CALLER, size); }
+
+                    /**
+                     *  @brief Releases a DeferredBroadcastCaller allocated by operator new.
+                     *  @param pointer The memory to release.
+                     *  @param size The size of the DeferredBroadcastCaller.
+                     */
+                    static void operator delete(void* pointer, size_t size) EASYDELEGATE_NOEXCEPT { AllocationAccounting::deallocate(ALLOCATION_DEFERRED_BROADCAST_CALLER, pointer, size); }
+                #endif
+
+                /**
+                 *  @brief Dispatches the DeferredBroadcastCaller, invoking every delegate with the cached parameters
+                 *  and ignoring return values.
+                 *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls.
+                 *  @note If this throws an exception, the invocation of the remaining delegates halts.
+                 */
+                EASYDELEGATE_INLINE void dispatch(void) const
+                {
+                    const StorageType& delegates = this->getDelegates();
+
+                    #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                        LatencyTimer<ConcurrentLatencyHistogram> timer(mDelegateSet ? &mDelegateSet->getBroadcastLatency() : NULL, TimingSampler::sampleBroadcast());
+                    #endif
+
+                    for (auto it = delegates.begin(); it != delegates.end(); it++)
+                        this->performCachedCall(*it, typename gens<sizeof...(parameters)>::type());
+                }
+
+                /**
+                 *  @brief Dispatches the DeferredBroadcastCaller, invoking every delegate with the cached parameters
+                 *  and storing return values in out.
+                 *  @param out The std::vector that all return values will be sequentially written to.
+                 *  @throw std::exception Any exception can be potentially thrown by the functions each delegate calls.
+                 *  @note If this throws an exception, the invocation of the remaining delegates halts.
+                 */
+                EASYDELEGATE_INLINE void dispatch(std::vector<returnType>& out) const
+                {
+                    const StorageType& delegates = this->getDelegates();
+
+                    #ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+                        LatencyTimer<ConcurrentLatencyHistogram> timer(mDelegateSet ? &mDelegateSet->getBroadcastLatency() : NULL, TimingSampler::sampleBroadcast());
+                    #endif
+
+                    for (auto it = delegates.begin(); it != delegates.end(); it++)
+                        out.push_back(this->performCachedCall(*it, typename gens<sizeof...(parameters)>::type()));
+                }
+
+                /**
+                 *  @brief Dispatches the DeferredBroadcastCaller, ignoring return values.
+                 *  @details This behaves exactly as the dispatch method above. This method is also callable
+                 *  on the IDeferredCaller type, unlike the normal dispatch method.
+                 */
+                EASYDELEGATE_INLINE void genericDispatch(void) const
+                {
+                    #ifdef EASYDELEGATE_USDT_PROBES
+                        DispatchProbe probe(this);
+                    #endif
+
+                    #ifdef EASYDELEGATE_TRACING
+                        TraceScope scope("IDeferredCaller::genericDispatch", this, 'f', this->getTraceFlowID());
+                    #endif
+
+                    dispatch();
+                }
+
+                /**
+                 *  @brief Returns whether or not this DeferredBroadcastCaller holds a snapshot of delegates rather than
+                 *  referring to a DelegateSet.
+                 *  @return A boolean representing whether or not this DeferredBroadcastCaller holds a snapshot.
+                 */
+                EASYDELEGATE_INLINE bool isSnapshot(void) const EASYDELEGATE_NOEXCEPT { return mDelegateSet == NULL; }
+
+                /**
+                 *  @brief Returns whether or not this DeferredBroadcastCaller invokes the same DelegateSet as the given
+                 *  deferred caller of unknown type.
+                 *  @param other A pointer to the IDeferredCaller to check against.
+                 *  @return A boolean representing whether or not both deferred callers refer to the same DelegateSet.
+                 *  @note Always returns false for snapshots, as their delegate lists are independent.
+                 */
+                EASYDELEGATE_INLINE bool hasSameMethodAs(const IDeferredCaller* other) const EASYDELEGATE_NOEXCEPT
+                {
+                    return mDelegateSet && other->getTypeTag() == this->getTypeTag() &&
+                    static_cast<const BasicDeferredBroadcastCaller*>(other)->mDelegateSet == mDelegateSet;
+                }
+
+                /**
+                 *  @brief Returns a hash of the DelegateSet this DeferredBroadcastCaller invokes.
+                 *  @return A hash of the DelegateSet address.
+                 */
+                EASYDELEGATE_INLINE size_t getMethodHash(void) const EASYDELEGATE_NOEXCEPT { return hashMethodPointer(this->getTypeTag(), mDelegateSet); }
+
+                /**
+                 *  @brief Returns the address identifying the DeferredBroadcastCaller type.
+                 *  @return The address of the TypeTag of this deferred caller type.
+                 */
+                EASYDELEGATE_INLINE const void* getTypeTag(void) const EASYDELEGATE_NOEXCEPT { return &TypeTag<BasicDeferredBroadcastCaller>::sTag; }
+
+            // Private Methods
+            private:
+                //! Returns the list of delegates to invoke.
+                EASYDELEGATE_INLINE const StorageType& getDelegates(void) const EASYDELEGATE_NOEXCEPT
+                {
+                    return mDelegateSet ? static_cast<const StorageType&>(*mDelegateSet) : mSnapshot;
+                }
+
+                //! Internal templated method to invoke a delegate with the cached parameters.
+                template<int ...S>
+                EASYDELEGATE_INLINE returnType performCachedCall(StoredDelegateType* delegateInstance, seq<S...>) const
+                {
+                    return DelegateSetType::template invokeDelegate<errorPolicy>(mDelegateSet, delegateInstance, std::get<S>(mParameters) ...);
+                }
+
+            // Private Members
+            private:
+                //! The DelegateSet to invoke, or NULL if a snapshot is held.
+                const DelegateSetType* mDelegateSet;
+                //! The snapshot of delegates to invoke. Empty when referring to a DelegateSet.
+                const StorageType mSnapshot;
+
+                //! Internal std::tuple that is utilized to cache the parameter list.
+                const NoReferenceTuple<parameters...> mParameters;
+        };
+    #endif // EASYDELEGATE_NO_DEFERRED_CALLING
+
+    /**
+     *  @brief An input range over the return values of the delegates in a DelegateSet, invoking each
+     *  delegate only when iteration reaches it.
+     *  @details Like std::istream_iterator, begin invokes the first delegate and each increment invokes the
+     *  next, with dereferencing returning the cached return value. Stopping early leaves the remaining
+     *  delegates uninvoked. The arguments are stored once in an std::tuple, as a DeferredBroadcastCaller
+     *  stores them. Each call goes through DelegateSetCore::invokeDelegate, so per listener instrumentation
+     *  applies, but broadcast latency is not recorded as the invocation is spread across the caller's work.
+     *  Each delegate is invoked under the error policy of the set. LazyInvocation is this type with
+     *  CheckedCallPolicy.
+     *  @note The return type must be default constructible and copy assignable.
+     */
+    template <typename returnType, typename... parameters, typename errorPolicy>
+    class BasicLazyInvocation<returnType(parameters...), errorPolicy>
+    {
+        // Public Methods
+        public:
+            //! Helper typedef referring to the part of a DelegateSet with any policies that this range invokes.
+            typedef DelegateSetCore<returnType, parameters...> DelegateSetType;
+            //! Helper typedef referring to the delegate type this range invokes.
+            typedef ITypedDelegate<returnType, parameters...> StoredDelegateType;
+
+            //! An input iterator over the return values of a LazyInvocation.
+            class Iterator
+            {
+                // Public Methods
+                public:
+                    //! Standard iterator typedef.
+                    typedef std::input_iterator_tag iterator_category;
+                    //! Standard iterator typedef.
+                    typedef returnType value_type;
+                    //! Standard iterator typedef.
+                    typedef ptrdiff_t difference_type;
+                    //! Standard iterator typedef.
+                    typedef const returnType* pointer;
+                    //! Standard iterator typedef.
+                    typedef const returnType& reference;
+
+                    //! Constructs the end iterator.
+                    Iterator(void) EASYDELEGATE_NOEXCEPT : mInvocation(NULL) { }
+
+                    /**
+                     *  @brief Constructor accepting the range being iterated.
+                     *  @param invocation The range being iterated.
+                     */
+                    explicit Iterator(BasicLazyInvocation* invocation) EASYDELEGATE_NOEXCEPT : mInvocation(invocation) { }
+
+                    //! Returns the return value of the delegate most recently invoked.
+                    EASYDELEGATE_INLINE reference operator *(void) const EASYDELEGATE_NOEXCEPT { return mInvocation->mCurrent; }
+
+                    //! Returns a pointer to the return value of the delegate most recently invoked.
+                    EASYDELEGATE_INLINE pointer operator ->(void) const EASYDELEGATE_NOEXCEPT { return &mInvocation->mCurrent; }
+
+                    //! Invokes the next delegate.
+                    EASYDELEGATE_INLINE Iterator& operator ++(void)
+                    {
+                        mInvocation->advance();
+                        return *this;
+                    }
+
+                    //! Invokes the next delegate. The returned iterator refers to the same range.
+                    EASYDELEGATE_INLINE Iterator operator ++(int)
+                    {
+                        mInvocation->advance();
+                        return *this;
+                    }
+
+                    //! Returns the delegate that produced the current return value.
+                    EASYDELEGATE_INLINE StoredDelegateType* getDelegate(void) const { return mInvocation->mCurrentDelegate; }
+
+                    //! Returns whether or not two iterators are both at the end of their ranges, or refer to the same range.
+                    EASYDELEGATE_INLINE bool operator ==(const Iterator& other) const EASYDELEGATE_NOEXCEPT
+                    {
+                        return this->isEnd() ? other.isEnd() : mInvocation == other.mInvocation;
+                    }
+
+                    //! Returns the inverse of operator ==.
+                    EASYDELEGATE_INLINE bool operator !=(const Iterator& other) const EASYDELEGATE_NOEXCEPT { return !(*this == other); }
+
+                // Private Methods
+                private:
+                    //! Returns whether or not this iterator is past the last delegate.
+                    EASYDELEGATE_INLINE bool isEnd(void) const EASYDELEGATE_NOEXCEPT { return !mInvocation || !mInvocation->mCurrentDelegate; }
+
+                // Private Members
+                private:
+                    //! The range being iterated, or NULL for the end iterator.
+                    BasicLazyInvocation* mInvocation;
+            };
+
+            /**
+             *  @brief Constructor accepting the DelegateSet to invoke.
+             *  @param delegateSet The DelegateSet whose delegates will be invoked.
+             *  @param params The parameter list to invoke each delegate with.
+             *  @warning The LazyInvocation is only valid while the given DelegateSet remains valid.
+             */
+            BasicLazyInvocation(const DelegateSetType& delegateSet, parameters... params) : mDelegateSet(&delegateSet), mNextIndex(0),
+            mCurrentDelegate(NULL), mCurrent(), mParameters(params...) { }
+
+            /**
+             *  @brief Returns an iterator at the current position, invoking the first delegate if iteration has
+             *  not started.
+             *  @return An iterator over the remaining return values.
+             *  @throw std::exception Any exception can be potentially thrown by the function the first delegate calls.
+             */
+            Iterator begin(void)
+            {
+                if (mNextIndex == 0)
+                    this->advance();
+
+                return Iterator(this);
+            }
+
+            //! Returns the end iterator.
+            EASYDELEGATE_INLINE Iterator end(void) const EASYDELEGATE_NOEXCEPT { return Iterator(); }
+
+        // Private Methods
+        private:
+            //! Invokes the next delegate in the set and caches its return value, or marks the range exhausted.
+            void advance(void)
+            {
+                if (mNextIndex >= mDelegateSet->size())
+                {
+                    mCurrentDelegate = NULL;
+                    mNextIndex = mDelegateSet->size() + 1;
+                    return;
+                }
+
+                mCurrentDelegate = (*mDelegateSet)[mNextIndex++];
+                mCurrent = this->performCachedCall(mCurrentDelegate, typename gens<sizeof...(parameters)>::type());
+            }
+
+            //! Internal templated method to invoke a delegate with the cached parameters.
+            template<int... S>
+            EASYDELEGATE_INLINE returnType performCachedCall(StoredDelegateType* delegateInstance, seq<S...>) const
+            {
+                return DelegateSetType::template invokeDelegate<errorPolicy>(mDelegateSet, delegateInstance, std::get<S>(mParameters) ...);
+            }
+
+        // Private Members
+        private:
+            //! The DelegateSet being invoked.
+            const DelegateSetType* mDelegateSet;
+            //! The index of the next delegate to invoke.
+            size_t mNextIndex;
+            //! The delegate that produced mCurrent, or NULL once the range is exhausted.
+            StoredDelegateType* mCurrentDelegate;
+            //! The return value of the delegate most recently invoked.
+            returnType mCurrent;
+            //! Internal std::tuple that is utilized to cache the parameter list.
+            const NoReferenceTuple<parameters...> mParameters;
     };
 }
 #endif // _INCLUDE_EASYDELEGATE_DELEGATESET_HPP_
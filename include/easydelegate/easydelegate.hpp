@@ -46,12 +46,26 @@
     #define EASYDELEGATE_INLINE
 #endif
 
+// Keep calls out of line where inlining them would hide what the caller does from the compiler
+#if defined(__GNUC__) || defined(__GNUG__)
+    #define EASYDELEGATE_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+    #define EASYDELEGATE_NOINLINE __declspec(noinline)
+#else
+    //! A preprocessor definition for a keyword that prevents the inlining of a given method.
+    #define EASYDELEGATE_NOINLINE
+#endif
+
 #include "types.hpp"
 
 #if ISCPP11
     #include "delegates.hpp"
     #include "delegateset.hpp"
+    #include "prioritydelegateset.hpp"
+    #include "channeldelegateset.hpp"
     #include "deferredcallers.hpp"
+    #include "deferredqueue.hpp"
+    #include "deferredjournal.hpp"
 #else
     #include "delegatesCompat.hpp"
     #include "delegatesetCompat.hpp"
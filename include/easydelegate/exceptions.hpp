@@ -15,8 +15,126 @@
 
 #include <stdexcept>  // std::exception
 
+#ifdef EASYDELEGATE_NO_EXCEPTIONS
+    #include <stdio.h>    // fprintf
+    #include <stdlib.h>   // abort
+#endif
+
 namespace EasyDelegate
 {
+    /**
+     *  @brief The failures the EasyDelegate library can report, one per exception type.
+     */
+    enum DelegateError
+    {
+        //! No failure.
+        DELEGATE_ERROR_NONE = 0,
+        //! A member delegate attempted to make a call using a NULL 'this' pointer. See InvalidThisPointerException.
+        DELEGATE_ERROR_INVALID_THIS_POINTER,
+        //! A delegate attempted to make a call against a NULL method pointer. See InvalidMethodPointerException.
+        DELEGATE_ERROR_INVALID_METHOD_POINTER,
+        //! A deferred call journal could not be opened, created or mapped. See JournalIOException.
+        DELEGATE_ERROR_JOURNAL_IO,
+        //! A record did not fit in a deferred call journal. See JournalFullException.
+        DELEGATE_ERROR_JOURNAL_FULL,
+        //! A deferred call journal met an unregistered or mismatched method ID. See InvalidJournalMethodException.
+        DELEGATE_ERROR_INVALID_JOURNAL_METHOD
+    };
+
+    /**
+     *  @brief Returns a description of a failure.
+     *  @param error The failure to describe.
+     *  @return A pointer to the text of the failure, which is the same as the text of its exception.
+     */
+    inline const char* getDelegateErrorMessage(const DelegateError& error)
+    {
+        switch (error)
+        {
+            case DELEGATE_ERROR_NONE:
+                return "No error";
+            case DELEGATE_ERROR_INVALID_THIS_POINTER:
+                return "Attempted to call a class member method against a NULL 'this' pointer";
+            case DELEGATE_ERROR_INVALID_METHOD_POINTER:
+                return "Attempted to perform a call against a NULL method pointer";
+            case DELEGATE_ERROR_JOURNAL_IO:
+                return "Failed to open, create or map the deferred call journal";
+            case DELEGATE_ERROR_JOURNAL_FULL:
+                return "Attempted to append a record to a full deferred call journal";
+            case DELEGATE_ERROR_INVALID_JOURNAL_METHOD:
+                return "Attempted to journal or replay a call against an unregistered or mismatched method ID";
+        }
+
+        return "Unknown error";
+    }
+
+    #ifdef EASYDELEGATE_NO_EXCEPTIONS
+        //! The handler called when the library fails with EASYDELEGATE_NO_EXCEPTIONS defined. It may log the failure.
+        typedef void (*DelegateFailureHandler)(const DelegateError& error);
+
+        /**
+         *  @brief Reports library failures in place of exceptions when EASYDELEGATE_NO_EXCEPTIONS is defined.
+         *  @details Every failure that would otherwise throw calls the failure handler and then aborts, as the
+         *  failing call has nothing it could return. The default handler writes the failure to stderr. Code that
+         *  needs to recover from a failure should check for it beforehand, with getCallError or
+         *  DelegateSet::tryInvoke. The handler should be set before any delegates are invoked, as it is not
+         *  synchronized with invocation.
+         */
+        class DelegateFailure
+        {
+            // Public Methods
+            public:
+                /**
+                 *  @brief Sets the handler called before the program aborts on a failure.
+                 *  @param handler The handler to call, or NULL to restore the default handler.
+                 */
+                static void setHandler(DelegateFailureHandler handler) { DelegateFailure::getHandlerStorage() = handler; }
+
+                //! Returns the handler called before the program aborts on a failure, or NULL for the default.
+                static DelegateFailureHandler getHandler(void) { return DelegateFailure::getHandlerStorage(); }
+
+                /**
+                 *  @brief Reports a failure through the handler and aborts.
+                 *  @param error The failure to report.
+                 */
+                static void raise(const DelegateError& error)
+                {
+                    DelegateFailureHandler handler = DelegateFailure::getHandler();
+
+                    if (handler)
+                        handler(error);
+                    else
+                        fprintf(stderr, "EasyDelegate: %s\n", getDelegateErrorMessage(error));
+
+                    abort();
+                }
+
+            // Private Methods
+            private:
+                //! Returns the installed handler.
+                static DelegateFailureHandler& getHandlerStorage(void)
+                {
+                    static DelegateFailureHandler handler = NULL;
+                    return handler;
+                }
+        };
+
+        //! Reports a failure through DelegateFailure rather than throwing the given exception type.
+        #define EASYDELEGATE_RAISE(exceptionType, error) EasyDelegate::DelegateFailure::raise(error)
+    #else
+        //! Throws the given exception type. With EASYDELEGATE_NO_EXCEPTIONS defined, calls DelegateFailure::raise instead.
+        #define EASYDELEGATE_RAISE(exceptionType, error) throw exceptionType()
+    #endif
+
+    #ifdef EASYDELEGATE_UNCHECKED
+        #define EASYDELEGATE_CHECK_CALL(condition, exceptionType, error) ((void)0)
+        #define EASYDELEGATE_CHECK_CONSTRUCTION(condition, exceptionType, error) do { if (!(condition)) EASYDELEGATE_RAISE(exceptionType, error); } while (0)
+    #else
+        //! Raises the failure when condition is false at call time. Compiled out when EASYDELEGATE_UNCHECKED is defined.
+        #define EASYDELEGATE_CHECK_CALL(condition, exceptionType, error) do { if (!(condition)) EASYDELEGATE_RAISE(exceptionType, error); } while (0)
+        //! Raises the failure when condition is false at construction. Only compiled in when EASYDELEGATE_UNCHECKED is defined.
+        #define EASYDELEGATE_CHECK_CONSTRUCTION(condition, exceptionType, error) ((void)0)
+    #endif
+
     /**
      *  @brief A general base exception type for all exceptions that is thrown
      *  by the EasyDelegate library.
@@ -39,7 +157,7 @@ namespace EasyDelegate
              */
             virtual const char* what() const throw()
             {
-                return "Attempted to call a class member method against a NULL 'this' pointer";
+                return getDelegateErrorMessage(DELEGATE_ERROR_INVALID_THIS_POINTER);
             }
     };
 
@@ -59,7 +177,65 @@ namespace EasyDelegate
              */
             virtual const char* what() const throw()
             {
-                return "Attempted to perform a call against a NULL method pointer";
+                return getDelegateErrorMessage(DELEGATE_ERROR_INVALID_METHOD_POINTER);
+            }
+    };
+
+    /**
+     *  @brief An exception type that is thrown by the EasyDelegate library when
+     *  a deferred call journal could not be opened, created or mapped.
+     */
+    class JournalIOException : public DelegateException
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Returns a pointer to the exception text from the
+             *  exception.
+             *  @return A pointer to the exception text in this exception.
+             */
+            virtual const char* what() const throw()
+            {
+                return getDelegateErrorMessage(DELEGATE_ERROR_JOURNAL_IO);
+            }
+    };
+
+    /**
+     *  @brief An exception type that is thrown by the EasyDelegate library when
+     *  a record does not fit in the remaining space of a deferred call journal.
+     */
+    class JournalFullException : public DelegateException
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Returns a pointer to the exception text from the
+             *  exception.
+             *  @return A pointer to the exception text in this exception.
+             */
+            virtual const char* what() const throw()
+            {
+                return getDelegateErrorMessage(DELEGATE_ERROR_JOURNAL_FULL);
+            }
+    };
+
+    /**
+     *  @brief An exception type that is thrown by the EasyDelegate library when
+     *  a deferred call journal encounters a method ID that is not registered or
+     *  was registered with a different method signature.
+     */
+    class InvalidJournalMethodException : public DelegateException
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Returns a pointer to the exception text from the
+             *  exception.
+             *  @return A pointer to the exception text in this exception.
+             */
+            virtual const char* what() const throw()
+            {
+                return getDelegateErrorMessage(DELEGATE_ERROR_INVALID_JOURNAL_METHOD);
             }
     };
 } // End NameSpace EasyDelegate
@@ -0,0 +1,391 @@
+/**
+ *  @file histogram.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the HDR style latency histograms that are recorded when
+ *  EASYDELEGATE_LATENCY_HISTOGRAMS is defined.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_HISTOGRAM_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_HISTOGRAM_HPP_
+
+#ifdef EASYDELEGATE_LATENCY_HISTOGRAMS
+    #include <atomic>           // std::atomic
+    #include <chrono>           // std::chrono::nanoseconds
+    #include <math.h>           // ceil
+    #include <stdint.h>         // uint64_t
+    #include <string.h>         // memset
+
+    #include "timing.hpp"
+
+    #ifndef EASYDELEGATE_HISTOGRAM_SHARDS
+        //! The number of per thread shards a ConcurrentLatencyHistogram spreads recording across. May be defined before inclusion.
+        #define EASYDELEGATE_HISTOGRAM_SHARDS 8
+    #endif
+
+namespace EasyDelegate
+{
+    /**
+     *  @brief A high dynamic range histogram of latencies from 1ns to about 18 minutes.
+     *  @details Buckets are log-linear: every power of two is split into 32 equally sized buckets, so any
+     *  recorded value is reported to within about 3% of its true value. Values beyond the range are counted
+     *  in the highest bucket. Histograms can be merged, so histograms recorded separately by different
+     *  threads or queues can be combined before reading percentiles.
+     *
+     *  LatencyHistogram is not thread safe. Use ConcurrentLatencyHistogram to record from several threads.
+     */
+    class LatencyHistogram
+    {
+        // Public Members
+        public:
+            //! The number of bits of precision within each power of two.
+            static const unsigned int sSubBucketBits = 5;
+            //! The number of buckets within each power of two.
+            static const unsigned int sSubBucketCount = 1 << sSubBucketBits;
+            //! The highest power of two that is tracked. Larger values are clamped.
+            static const unsigned int sMaximumExponent = 40;
+            //! The total number of buckets.
+            static const unsigned int sBucketCount = (sMaximumExponent - sSubBucketBits + 1) * sSubBucketCount;
+
+        // Public Methods
+        public:
+            //! Standard constructor, creating an empty histogram.
+            LatencyHistogram(void) EASYDELEGATE_NOEXCEPT { this->reset(); }
+
+            /**
+             *  @brief Returns the bucket a value is counted in.
+             *  @param value The value in nanoseconds.
+             *  @return The index of the bucket.
+             */
+            static EASYDELEGATE_INLINE unsigned int getBucketIndex(uint64_t value) EASYDELEGATE_NOEXCEPT
+            {
+                if (value < sSubBucketCount)
+                    return static_cast<unsigned int>(value);
+
+                if (value >> sMaximumExponent)
+                    return sBucketCount - 1;
+
+                #if defined(__GNUC__) || defined(__clang__)
+                    const unsigned int exponent = 63 - static_cast<unsigned int>(__builtin_clzll(value));
+                #else
+                    unsigned int exponent = 0;
+                    for (uint64_t remaining = value >> 1; remaining; remaining >>= 1)
+                        ++exponent;
+                #endif
+
+                const unsigned int shift = exponent - sSubBucketBits;
+                return (shift + 1) * sSubBucketCount + static_cast<unsigned int>(value >> shift) - sSubBucketCount;
+            }
+
+            /**
+             *  @brief Returns the highest value counted in a bucket.
+             *  @param index The index of the bucket.
+             *  @return The highest value in nanoseconds that is counted in the bucket.
+             */
+            static EASYDELEGATE_INLINE uint64_t getBucketValue(const unsigned int& index) EASYDELEGATE_NOEXCEPT
+            {
+                if (index < sSubBucketCount)
+                    return index;
+
+                const unsigned int shift = index / sSubBucketCount - 1;
+                const uint64_t lowest = static_cast<uint64_t>(index % sSubBucketCount + sSubBucketCount) << shift;
+                return lowest + (static_cast<uint64_t>(1) << shift) - 1;
+            }
+
+            /**
+             *  @brief Records a latency.
+             *  @param latency The latency to record.
+             *  @param count The number of times to record it, such as the number of events a sampled event stands for.
+             */
+            EASYDELEGATE_INLINE void record(const std::chrono::nanoseconds& latency, const unsigned int& count=1) EASYDELEGATE_NOEXCEPT
+            {
+                this->recordCount(latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0, count);
+            }
+
+            /**
+             *  @brief Records a value a number of times.
+             *  @param value The value in nanoseconds.
+             *  @param count The number of times to record it.
+             */
+            EASYDELEGATE_INLINE void recordCount(const uint64_t& value, const uint64_t& count) EASYDELEGATE_NOEXCEPT
+            {
+                mCounts[LatencyHistogram::getBucketIndex(value)] += count;
+                mTotalCount += count;
+                mTotal += value * count;
+
+                if (value < mMinimum)
+                    mMinimum = value;
+                if (value > mMaximum)
+                    mMaximum = value;
+            }
+
+            /**
+             *  @brief Adds every value recorded in another histogram to this histogram.
+             *  @param other The histogram to merge.
+             */
+            void merge(const LatencyHistogram& other) EASYDELEGATE_NOEXCEPT
+            {
+                for (unsigned int index = 0; index < sBucketCount; ++index)
+                    mCounts[index] += other.mCounts[index];
+
+                mTotalCount += other.mTotalCount;
+                mTotal += other.mTotal;
+
+                if (other.mMinimum < mMinimum)
+                    mMinimum = other.mMinimum;
+                if (other.mMaximum > mMaximum)
+                    mMaximum = other.mMaximum;
+            }
+
+            //! Removes every recorded value.
+            void reset(void) EASYDELEGATE_NOEXCEPT
+            {
+                memset(mCounts, 0, sizeof(mCounts));
+                mTotalCount = 0;
+                mTotal = 0;
+                mMinimum = UINT64_MAX;
+                mMaximum = 0;
+            }
+
+            /**
+             *  @brief Returns the latency at or below which the given percentage of recorded values fall.
+             *  @param percentile The percentile, from 0 to 100. For example, 99.9.
+             *  @return The highest value of the bucket holding the percentile, which is never more than about 3%
+             *  above the true value and never above the maximum recorded value. Zero if nothing was recorded.
+             */
+            std::chrono::nanoseconds getValueAtPercentile(const double& percentile) const EASYDELEGATE_NOEXCEPT
+            {
+                if (!mTotalCount)
+                    return std::chrono::nanoseconds(0);
+
+                const double clamped = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+                uint64_t target = static_cast<uint64_t>(ceil(clamped / 100.0 * mTotalCount));
+                if (target < 1)
+                    target = 1;
+
+                uint64_t seen = 0;
+                for (unsigned int index = 0; index < sBucketCount; ++index)
+                {
+                    seen += mCounts[index];
+
+                    if (seen >= target)
+                    {
+                        const uint64_t value = LatencyHistogram::getBucketValue(index);
+                        return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(value < mMaximum ? value : mMaximum));
+                    }
+                }
+
+                return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(mMaximum));
+            }
+
+            //! Returns the number of values recorded.
+            EASYDELEGATE_INLINE uint64_t getCount(void) const EASYDELEGATE_NOEXCEPT { return mTotalCount; }
+
+            //! Returns the smallest value recorded, or zero if nothing was recorded.
+            EASYDELEGATE_INLINE std::chrono::nanoseconds getMinimum(void) const EASYDELEGATE_NOEXCEPT
+            {
+                return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(mTotalCount ? mMinimum : 0));
+            }
+
+            //! Returns the largest value recorded, or zero if nothing was recorded.
+            EASYDELEGATE_INLINE std::chrono::nanoseconds getMaximum(void) const EASYDELEGATE_NOEXCEPT
+            {
+                return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(mMaximum));
+            }
+
+            //! Returns the mean of the values recorded, or zero if nothing was recorded.
+            EASYDELEGATE_INLINE std::chrono::nanoseconds getMean(void) const EASYDELEGATE_NOEXCEPT
+            {
+                return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(mTotalCount ? mTotal / mTotalCount : 0));
+            }
+
+            /**
+             *  @brief Returns the number of values counted in a bucket.
+             *  @param index The index of the bucket.
+             *  @return The count of the bucket.
+             */
+            EASYDELEGATE_INLINE uint64_t getBucketCount(const unsigned int& index) const EASYDELEGATE_NOEXCEPT { return mCounts[index]; }
+
+        // Private Members
+        private:
+            //! The number of values counted in each bucket.
+            uint64_t mCounts[sBucketCount];
+            //! The number of values recorded.
+            uint64_t mTotalCount;
+            //! The sum of the values recorded, in nanoseconds.
+            uint64_t mTotal;
+            //! The smallest value recorded, in nanoseconds.
+            uint64_t mMinimum;
+            //! The largest value recorded, in nanoseconds.
+            uint64_t mMaximum;
+    };
+
+    /**
+     *  @brief A LatencyHistogram that any number of threads can record into without locking.
+     *  @details Recording is spread across per thread shards, each allocated on first use, so threads
+     *  rarely share counters and a histogram only recorded from one thread only allocates one shard.
+     *  Counters are updated with relaxed atomics, so threads that do end up sharing a shard remain correct.
+     *  Reading merges every shard into a LatencyHistogram snapshot.
+     */
+    class ConcurrentLatencyHistogram
+    {
+        // Public Methods
+        public:
+            //! Standard constructor, creating an empty histogram.
+            ConcurrentLatencyHistogram(void) EASYDELEGATE_NOEXCEPT
+            {
+                for (unsigned int shard = 0; shard < EASYDELEGATE_HISTOGRAM_SHARDS; ++shard)
+                    mShards[shard].store(NULL, std::memory_order_relaxed);
+            }
+
+            //! Standard destructor.
+            ~ConcurrentLatencyHistogram(void)
+            {
+                for (unsigned int shard = 0; shard < EASYDELEGATE_HISTOGRAM_SHARDS; ++shard)
+                    delete mShards[shard].load(std::memory_order_relaxed);
+            }
+
+            /**
+             *  @brief Records a latency into the calling thread's shard.
+             *  @param latency The latency to record.
+             *  @param count The number of times to record it, such as the number of events a sampled event stands for.
+             */
+            EASYDELEGATE_INLINE void record(const std::chrono::nanoseconds& latency, const unsigned int& count=1)
+            {
+                const uint64_t value = latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0;
+
+                Shard& shard = this->getShard();
+                shard.mCounts[LatencyHistogram::getBucketIndex(value)].fetch_add(count, std::memory_order_relaxed);
+            }
+
+            /**
+             *  @brief Returns a snapshot of every value recorded so far.
+             *  @return A LatencyHistogram holding the merged contents of every shard.
+             *  @note Values recorded concurrently with the snapshot may or may not be included. The minimum,
+             *  maximum and mean of the snapshot are derived from bucket values.
+             */
+            LatencyHistogram getSnapshot(void) const
+            {
+                LatencyHistogram result;
+
+                for (unsigned int shardIndex = 0; shardIndex < EASYDELEGATE_HISTOGRAM_SHARDS; ++shardIndex)
+                {
+                    const Shard* shard = mShards[shardIndex].load(std::memory_order_acquire);
+                    if (!shard)
+                        continue;
+
+                    for (unsigned int index = 0; index < LatencyHistogram::sBucketCount; ++index)
+                    {
+                        const uint64_t count = shard->mCounts[index].load(std::memory_order_relaxed);
+
+                        if (count)
+                            result.recordCount(LatencyHistogram::getBucketValue(index), count);
+                    }
+                }
+
+                return result;
+            }
+
+            //! Removes every recorded value. Values recorded concurrently with the reset may survive it.
+            void reset(void) EASYDELEGATE_NOEXCEPT
+            {
+                for (unsigned int shardIndex = 0; shardIndex < EASYDELEGATE_HISTOGRAM_SHARDS; ++shardIndex)
+                {
+                    Shard* shard = mShards[shardIndex].load(std::memory_order_acquire);
+                    if (!shard)
+                        continue;
+
+                    for (unsigned int index = 0; index < LatencyHistogram::sBucketCount; ++index)
+                        shard->mCounts[index].store(0, std::memory_order_relaxed);
+                }
+            }
+
+        // Private Members
+        private:
+            //! The counters of one shard.
+            struct Shard
+            {
+                //! Standard constructor, zeroing every counter.
+                Shard(void) EASYDELEGATE_NOEXCEPT
+                {
+                    for (unsigned int index = 0; index < LatencyHistogram::sBucketCount; ++index)
+                        mCounts[index].store(0, std::memory_order_relaxed);
+                }
+
+                //! The number of values counted in each bucket.
+                std::atomic<uint64_t> mCounts[LatencyHistogram::sBucketCount];
+            };
+
+            //! The lazily allocated shards.
+            std::atomic<Shard*> mShards[EASYDELEGATE_HISTOGRAM_SHARDS];
+
+        // Private Methods
+        private:
+            //! Returns the shard of the calling thread, allocating it on first use.
+            EASYDELEGATE_INLINE Shard& getShard(void)
+            {
+                std::atomic<Shard*>& slot = mShards[ConcurrentLatencyHistogram::getThreadShardIndex()];
+
+                Shard* shard = slot.load(std::memory_order_acquire);
+                if (shard)
+                    return *shard;
+
+                // Another thread mapped to the same shard may allocate it at the same time; keep whichever wins
+                Shard* created = new Shard();
+                if (slot.compare_exchange_strong(shard, created, std::memory_order_acq_rel))
+                    return *created;
+
+                delete created;
+                return *shard;
+            }
+
+            //! Returns the shard index of the calling thread, assigned round robin on first use.
+            static EASYDELEGATE_INLINE unsigned int getThreadShardIndex(void)
+            {
+                static std::atomic<unsigned int> nextIndex(0);
+                static thread_local unsigned int index = nextIndex.fetch_add(1, std::memory_order_relaxed) % EASYDELEGATE_HISTOGRAM_SHARDS;
+                return index;
+            }
+    };
+
+    /**
+     *  @brief Records the time it spends in scope into a histogram when it leaves scope.
+     *  @details Time is measured with the TimestampCounter. A timer created with a weight of 0 records nothing
+     *  and reads no time, which is how broadcasts skipped by the TimingSampler cost almost nothing.
+     */
+    template <typename histogramType>
+    class LatencyTimer
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the histogram to record into.
+             *  @param histogram The histogram to record into, or NULL to record nothing.
+             *  @param weight The number of times to record the latency, or 0 to record nothing.
+             */
+            EASYDELEGATE_INLINE LatencyTimer(histogramType* histogram, const unsigned int& weight=1) EASYDELEGATE_NOEXCEPT :
+            mHistogram(weight ? histogram : NULL), mWeight(weight), mStart(mHistogram ? TimestampCounter::read() : 0) { }
+
+            //! Records the time spent in scope.
+            EASYDELEGATE_INLINE ~LatencyTimer(void)
+            {
+                if (mHistogram)
+                    mHistogram->record(TimestampCounter::toDuration(TimestampCounter::read() - mStart), mWeight);
+            }
+
+        // Private Members
+        private:
+            //! The histogram to record into, or NULL.
+            histogramType* mHistogram;
+            //! The number of times to record the latency.
+            const unsigned int mWeight;
+            //! The tick count when the timer was created.
+            const uint64_t mStart;
+    };
+} // End NameSpace EasyDelegate
+#endif // EASYDELEGATE_LATENCY_HISTOGRAMS
+#endif // _INCLUDE_EASYDELEGATE_HISTOGRAM_HPP_
@@ -0,0 +1,124 @@
+/**
+ *  @file isolation.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the error buffer that DelegateSet::invokeIsolated records listener
+ *  exceptions into.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_ISOLATION_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_ISOLATION_HPP_
+
+#include <exception>        // std::exception_ptr
+#include <stddef.h>         // size_t
+#include <vector>
+
+#include "exceptions.hpp"
+
+namespace EasyDelegate
+{
+    class IDelegate;
+
+    /**
+     *  @brief Describes a single listener that threw or could not be invoked during an isolated invocation.
+     */
+    struct ListenerError
+    {
+        //! The delegate that threw. Cast it to the ITypedDelegate of its DelegateSet to query callsMethod.
+        const IDelegate* mDelegate;
+        //! The DelegateSet that invoked the delegate.
+        const void* mDelegateSet;
+        //! The index of the delegate in the set at the time of the invocation.
+        size_t mIndex;
+        //! Why the delegate was not invoked, or DELEGATE_ERROR_NONE if it was invoked and threw mException.
+        DelegateError mError;
+        //! The exception the delegate threw, or an empty pointer if it was not invoked. Pass it to std::rethrow_exception to inspect it.
+        std::exception_ptr mException;
+    };
+
+    /**
+     *  @brief A fixed capacity buffer of the exceptions thrown by listeners during isolated invocations.
+     *  @details All storage is allocated when the buffer is constructed, so recording an error never
+     *  allocates beyond what the runtime needs to keep the exception object alive. Errors past the capacity
+     *  are counted but not kept. A buffer may be reused across invocations, accumulating errors until it is
+     *  cleared.
+     */
+    class ListenerErrorBuffer
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the number of errors to keep.
+             *  @param capacity The maximum number of errors kept before further errors are only counted.
+             */
+            explicit ListenerErrorBuffer(const size_t& capacity) : mErrors(capacity), mCount(0), mDroppedCount(0) { }
+
+            /**
+             *  @brief Records an error, or counts it as dropped if the buffer is full.
+             *  @param delegateInstance The delegate that threw.
+             *  @param delegateSet The DelegateSet that invoked the delegate.
+             *  @param index The index of the delegate in the set.
+             *  @param error Why the delegate was not invoked, or DELEGATE_ERROR_NONE if it threw.
+             *  @param exception The exception the delegate threw, or an empty pointer.
+             */
+            void record(const IDelegate* delegateInstance, const void* delegateSet, const size_t& index, const DelegateError& error,
+            const std::exception_ptr& exception) EASYDELEGATE_NOEXCEPT
+            {
+                if (mCount == mErrors.size())
+                {
+                    ++mDroppedCount;
+                    return;
+                }
+
+                ListenerError& entry = mErrors[mCount++];
+                entry.mDelegate = delegateInstance;
+                entry.mDelegateSet = delegateSet;
+                entry.mIndex = index;
+                entry.mError = error;
+                entry.mException = exception;
+            }
+
+            /**
+             *  @brief Returns a recorded error.
+             *  @param index The index of the error, less than getCount().
+             *  @return A const reference to the error.
+             */
+            EASYDELEGATE_INLINE const ListenerError& getError(const size_t& index) const EASYDELEGATE_NOEXCEPT { return mErrors[index]; }
+
+            //! Returns the number of errors kept.
+            EASYDELEGATE_INLINE size_t getCount(void) const EASYDELEGATE_NOEXCEPT { return mCount; }
+
+            //! Returns the number of errors that were counted but not kept because the buffer was full.
+            EASYDELEGATE_INLINE size_t getDroppedCount(void) const EASYDELEGATE_NOEXCEPT { return mDroppedCount; }
+
+            //! Returns the maximum number of errors kept.
+            EASYDELEGATE_INLINE size_t getCapacity(void) const EASYDELEGATE_NOEXCEPT { return mErrors.size(); }
+
+            //! Returns whether or not any error was recorded, kept or dropped.
+            EASYDELEGATE_INLINE bool empty(void) const EASYDELEGATE_NOEXCEPT { return !mCount && !mDroppedCount; }
+
+            //! Forgets every recorded error, releasing the exceptions they hold.
+            void clear(void) EASYDELEGATE_NOEXCEPT
+            {
+                for (size_t index = 0; index < mCount; ++index)
+                    mErrors[index].mException = std::exception_ptr();
+
+                mCount = 0;
+                mDroppedCount = 0;
+            }
+
+        // Private Members
+        private:
+            //! The error storage, sized to the capacity when constructed.
+            std::vector<ListenerError> mErrors;
+            //! The number of errors kept.
+            size_t mCount;
+            //! The number of errors dropped because the buffer was full.
+            size_t mDroppedCount;
+    };
+} // End NameSpace EasyDelegate
+#endif // _INCLUDE_EASYDELEGATE_ISOLATION_HPP_
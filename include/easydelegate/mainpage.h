@@ -84,6 +84,111 @@
  *
  *  The output of this code will be "Got float: 3.14".
  *
+ *  @section combiners Combining Return Values
+ *  Rather than storing every return value, DelegateSet::invoke can fold them into a combiner as each delegate
+ *  returns, which allocates nothing:
+ *
+ *  @code
+ *  EasyDelegate::DelegateSet<double, const Order&> costEstimators;
+ *  const double totalCost = costEstimators.invoke(EasyDelegate::SumCombiner<double>(), order);
+ *  @endcode
+ *
+ *  SumCombiner, MinimumCombiner, MaximumCombiner, AllCombiner, AnyCombiner, FirstCombiner and LastCombiner are
+ *  provided. Any type with a ResultType typedef, a combine method and a getResult method can be used as well.
+ *
+ *  Return values can also be written straight into caller owned storage with DelegateSet::invokeInto, which
+ *  accepts any output iterator, or DelegateSet::invokeIntoBuffer, which accepts a pointer and a capacity.
+ *
+ *  DelegateSet::invokeLazy returns an input range that invokes each delegate only when iteration reaches it, so
+ *  return values can be consumed one at a time and iteration can stop before the remaining delegates are called.
+ *
+ *  DelegateSet::invoke stops at the first delegate to throw. DelegateSet::invokeIsolated instead catches each
+ *  delegate's exception, records it with the delegate in a ListenerErrorBuffer whose capacity is allocated up front,
+ *  and carries on with the next delegate.
+ *
+ *  Events that should stop at the first listener to handle them can use DelegateSet::invokeUntilHandled, which
+ *  stops once a delegate returns a value that converts to true, or DelegateSet::invokeUntil, which stops once a
+ *  predicate accepts a return value. Both return the delegate that handled the event, or NULL if none did.
+ *
+ *  @section ordering Listener Ordering
+ *  A DelegateSet invokes its delegates in the order they were added. A PriorityDelegateSet instead invokes them in
+ *  order of descending priority, given to PriorityDelegateSet::add, and in the order they were added within a
+ *  priority. The ordering is established when each delegate is added, so invoking the set costs the same as
+ *  invoking a DelegateSet.
+ *
+ *  A ChannelDelegateSet subscribes each delegate to a ChannelMask of up to 32 channels given to ChannelDelegateSet::add.
+ *  Invoking it with a ChannelMask calls only the delegates subscribed to at least one of those channels, finding them
+ *  with an SSE2 scan of the packed masks where available, so that filtered out delegates are never called.
+ *
+ *  @section policies Threading and Error Policies
+ *  DelegateSet is an alias of BasicDelegateSet with its default policies. A BasicDelegateSet is given its signature as a
+ *  function type followed by a threading policy and an error policy, all resolved at compile time:
+ *
+ *  @code
+ *  // Single threaded, with delegates checked once when added rather than on every call
+ *  typedef EasyDelegate::BasicDelegateSet<void(float), EasyDelegate::SingleThreadedPolicy, EasyDelegate::UncheckedCallPolicy> TickEvent;
+ *  // Every invocation and modification serialized by a std::mutex
+ *  typedef EasyDelegate::BasicDelegateSet<void(const Message&), EasyDelegate::LockedPolicy<> > MessageEvent;
+ *  @endcode
+ *
+ *  SingleThreadedPolicy, the default, takes no locks. LockedPolicy holds a mutex of the given type while the set is invoked
+ *  or modified, so listeners that invoke the set again need a recursive mutex. CheckedCallPolicy, the default, checks each
+ *  delegate when it is invoked, while UncheckedCallPolicy raises from operator += for a delegate that could not be invoked
+ *  and then invokes delegates without any checks. deferInvoke and invokeLazy read the set without its locks, so they only
+ *  compile with SingleThreadedPolicy; deferInvokeSnapshot copies the delegates under the ReadGuard for any other policy.
+ *
+ *  @section frozen Frozen Sets
+ *  Sets that are configured once and then only invoked can be frozen. BasicDelegateSet::freeze moves every delegate into a
+ *  FrozenDelegateSet, an immutable dispatch table that flattens each delegate into a thunk and its target, packs the targets
+ *  contiguously and groups consecutive delegates sharing a thunk, so that invoking it makes no virtual calls. A frozen set
+ *  may be invoked from any number of threads without locks, and FrozenDelegateSet::thaw moves its delegates back into a
+ *  mutable set when it needs to change.
+ *
+ *  @section Instrumentation Instrumentation
+ *  EasyDelegate can optionally instrument every delegate invoked by a DelegateSet. Each kind of instrumentation is enabled by
+ *  defining a preprocessor macro before including easydelegate.hpp and compiles to nothing otherwise:
+ *  <ul>
+ *      <li><b>EASYDELEGATE_LISTENER_STATISTICS</b>: Each delegate records its call count, exception count, total and maximum
+ *      invocation time. These are queried with DelegateSet::forEachStatistics or IDelegate::getStatistics.</li>
+ *      <li><b>EASYDELEGATE_TRACING</b>: DelegateSet::invoke, every delegate it invokes and IDeferredCaller::genericDispatch are
+ *      recorded as spans into per thread buffers, with flow events linking the creation of each deferred caller to its dispatch.
+ *      Tracer::flush writes them as Chrome Trace Event JSON, which chrome://tracing and Perfetto can open.</li>
+ *      <li><b>EASYDELEGATE_SLOW_LISTENER_DETECTION</b>: A latency threshold is configured per set with
+ *      DelegateSet::setSlowListenerThreshold or globally with SlowListenerDetector::getGlobal. Any single delegate invocation
+ *      exceeding it fires a callback describing the delegate, including its this pointer and a hash of the method it calls.
+ *      Invocations are only timed while a threshold applies.</li>
+ *      <li><b>EASYDELEGATE_LATENCY_HISTOGRAMS</b>: Each DelegateSet records an HDR style histogram of the time taken by every
+ *      full invocation, read with DelegateSet::getBroadcastLatency, and each DeferredCallQueue records the time every deferred
+ *      caller spent queued, read with DeferredCallQueue::getQueueLatency. Percentiles are read with
+ *      LatencyHistogram::getValueAtPercentile.</li>
+ *      <li><b>EASYDELEGATE_USDT_PROBES</b>: Static tracepoints from sys/sdt.h under the easydelegate provider. invoke__entry and
+ *      invoke__return carry the set address and delegate count, listener__entry and listener__return the set and delegate
+ *      addresses, dispatch__entry and dispatch__return the deferred caller address, add the set, delegate, this pointer and
+ *      static method of each delegate added with DelegateSet::operator+=, and remove the set and delegate of every removal. An
+ *      unattached probe is a single nop, so bpftrace or perf can attach to a production build without recompiling.</li>
+ *      <li><b>EASYDELEGATE_ALLOCATION_ACCOUNTING</b>: Every delegate and deferred caller is allocated through a class level
+ *      operator new that records its live count, bytes and high-water marks per kind, read with AllocationAccounting::getCounter.
+ *      The storage of each DelegateSet and DeferredCallQueue is allocated through an AccountingAllocator bound to the owner, read
+ *      with getStorageAllocations. AllocationAccounting::getThreadAllocationCount lets tests assert that an operation such as
+ *      DelegateSet::invoke allocates nothing.</li>
+ *  </ul>
+ *
+ *  Timing every call costs two TimestampCounter reads. To keep statistics and histograms enabled in production, set
+ *  TimingSampler::setListenerInterval and TimingSampler::setBroadcastInterval to time only about one in N calls or broadcasts,
+ *  with totals scaled back up to estimates.
+ *
+ *  @section errors Error Handling
+ *  By default, invoking a delegate or dispatching a deferred caller with a NULL this pointer or method throws an
+ *  InvalidThisPointerException or InvalidMethodPointerException. Two preprocessor macros change this:
+ *  <ul>
+ *  <li>EASYDELEGATE_NO_EXCEPTIONS: The library contains no throw, try or catch and builds with -fno-exceptions.
+ *  Failures call the handler given to DelegateFailure::setHandler, which may log them, and then abort. Use
+ *  getCallError or DelegateSet::tryInvoke, which returns a DelegateError rather than failing, to recover instead.</li>
+ *  <li>EASYDELEGATE_UNCHECKED: The NULL checks move from every call into the constructors of the delegates and
+ *  deferred callers, so a delegate that could fail can never be created and invocation performs no checks. The
+ *  mThisPointer members become private, and setThisPointer refuses NULL.</li>
+ *  </ul>
+ *
  *  @section Support Supported Compilers and Operating Systems
  *  EasyDelegate has been compiled and known to run on the following systems:
  *  <ul>
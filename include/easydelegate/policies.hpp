@@ -0,0 +1,174 @@
+/**
+ *  @file policies.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the threading and error policies a BasicDelegateSet is templated on.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_POLICIES_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_POLICIES_HPP_
+
+#include <mutex>            // std::mutex, std::lock_guard
+#include <utility>          // std::forward
+
+#include "exceptions.hpp"
+
+namespace EasyDelegate
+{
+    template <typename returnType, typename... parameters>
+    class ITypedDelegate;
+
+    /*
+     *  A threading policy is a type a BasicDelegateSet privately derives from, with a ReadGuard type held for
+     *  the duration of every invocation and a WriteGuard type held while delegates are added or removed. Both
+     *  are constructed from a const reference to the policy. Empty policies cost nothing, as the set derives
+     *  from them.
+     *
+     *  An error policy is a type with a static validate method called on every delegate added to the set and
+     *  a static call method that invokes a delegate with the given arguments.
+     */
+
+    /**
+     *  @brief Threading policy taking no locks, for sets only used from a single thread at a time.
+     */
+    class SingleThreadedPolicy
+    {
+        // Public Methods
+        public:
+            //! Guard held while the set is invoked. Does nothing.
+            class ReadGuard
+            {
+                // Public Methods
+                public:
+                    //! Constructor accepting the policy to guard.
+                    explicit ReadGuard(const SingleThreadedPolicy&) EASYDELEGATE_NOEXCEPT { }
+            };
+
+            //! Guard held while the set is modified. Does nothing.
+            typedef ReadGuard WriteGuard;
+    };
+
+    /**
+     *  @brief Threading policy serializing every invocation and modification of the set with a mutex.
+     *  @details Delegates are called with the mutex held, so a delegate that invokes or modifies the set it is
+     *  invoked by deadlocks unless mutexType is recursive, such as std::recursive_mutex. A reader writer policy
+     *  can be written by providing a ReadGuard taking a shared lock and a WriteGuard taking an exclusive one.
+     *  @note BasicDelegateSet::deferInvoke and BasicDelegateSet::invokeLazy would read the set without the mutex,
+     *  so they do not compile with this policy. BasicDelegateSet::deferInvokeSnapshot copies the delegates
+     *  with the mutex held instead.
+     */
+    template <typename mutexType = std::mutex>
+    class LockedPolicy
+    {
+        // Public Methods
+        public:
+            //! Helper typedef referring to the mutex type locked by the guards.
+            typedef mutexType MutexType;
+
+            //! Guard holding the mutex for its lifetime.
+            class ReadGuard
+            {
+                // Public Methods
+                public:
+                    //! Constructor accepting the policy whose mutex is locked.
+                    explicit ReadGuard(const LockedPolicy& policy) : mLock(policy.mMutex) { }
+
+                // Private Members
+                private:
+                    //! The lock held on the policy's mutex.
+                    std::lock_guard<mutexType> mLock;
+            };
+
+            //! Guard holding the mutex for its lifetime.
+            typedef ReadGuard WriteGuard;
+
+            //! Returns the mutex locked by the guards, for example to read contention counters.
+            EASYDELEGATE_INLINE mutexType& getMutex(void) const EASYDELEGATE_NOEXCEPT { return mMutex; }
+
+        // Private Members
+        private:
+            //! The mutex locked by the guards.
+            mutable mutexType mMutex;
+    };
+
+    /**
+     *  @brief Error policy checking every delegate when it is invoked, raising a DelegateException when it
+     *  cannot be.
+     *  @details This is the behaviour of DelegateSet. With EASYDELEGATE_UNCHECKED defined, the checks move to
+     *  the constructors of the delegates.
+     */
+    class CheckedCallPolicy
+    {
+        // Public Methods
+        public:
+            //! Accepts every delegate, as they are checked when invoked.
+            template <typename delegateType>
+            static EASYDELEGATE_INLINE void validate(const delegateType*) EASYDELEGATE_NOEXCEPT { }
+
+            /**
+             *  @brief Invokes the given delegate with its checks.
+             *  @param delegateInstance The delegate to invoke.
+             *  @param arguments The arguments to forward to the delegate.
+             *  @return The value returned by the delegate.
+             */
+            template <typename returnType, typename... parameters, typename... argumentTypes>
+            static EASYDELEGATE_INLINE returnType call(ITypedDelegate<returnType, parameters...>* delegateInstance, argumentTypes&&... arguments)
+            {
+                return delegateInstance->invoke(std::forward<argumentTypes>(arguments)...);
+            }
+    };
+
+    /**
+     *  @brief Error policy checking every delegate once when it is added to the set, so that invoking the set
+     *  performs no checks at all.
+     *  @details Adding a delegate whose getCallError reports a failure raises that failure from operator +=.
+     *  Delegates are then invoked through ITypedDelegate::invokeUnchecked. Every way of adding a delegate to a
+     *  BasicDelegateSet goes through operator +=, as its std::vector is not a public base.
+     */
+    class UncheckedCallPolicy
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Raises the failure invoking the given delegate would report, if any.
+             *  @param delegateInstance The delegate being added to the set.
+             *  @throw InvalidMethodPointerException Thrown when the delegate has a NULL function to call.
+             *  @throw InvalidThisPointerException Thrown when the delegate is a MemberDelegate with a NULL
+             *  this pointer.
+             */
+            template <typename delegateType>
+            static void validate(const delegateType* delegateInstance)
+            {
+                switch (delegateInstance->getCallError())
+                {
+                    case DELEGATE_ERROR_INVALID_THIS_POINTER:
+                        EASYDELEGATE_RAISE(InvalidThisPointerException, DELEGATE_ERROR_INVALID_THIS_POINTER);
+                        break;
+
+                    case DELEGATE_ERROR_INVALID_METHOD_POINTER:
+                        EASYDELEGATE_RAISE(InvalidMethodPointerException, DELEGATE_ERROR_INVALID_METHOD_POINTER);
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+
+            /**
+             *  @brief Invokes the given delegate without its checks.
+             *  @param delegateInstance The delegate to invoke.
+             *  @param arguments The arguments to forward to the delegate.
+             *  @return The value returned by the delegate.
+             */
+            template <typename returnType, typename... parameters, typename... argumentTypes>
+            static EASYDELEGATE_INLINE returnType call(ITypedDelegate<returnType, parameters...>* delegateInstance, argumentTypes&&... arguments)
+            {
+                return delegateInstance->invokeUnchecked(std::forward<argumentTypes>(arguments)...);
+            }
+    };
+} // End NameSpace EasyDelegate
+#endif // _INCLUDE_EASYDELEGATE_POLICIES_HPP_
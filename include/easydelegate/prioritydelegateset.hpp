@@ -0,0 +1,77 @@
+/**
+ *  @file prioritydelegateset.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the PriorityDelegateSet type, a DelegateSet that keeps its delegates
+ *  ordered by priority.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_PRIORITYDELEGATESET_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_PRIORITYDELEGATESET_HPP_
+
+#include <algorithm>        // std::upper_bound
+#include <functional>       // std::greater
+
+#include "annotateddelegateset.hpp"
+
+namespace EasyDelegate
+{
+    /**
+     *  @brief A DelegateSet whose delegates are invoked in order of descending priority, and in the order
+     *  they were added within a priority.
+     *  @details The priorities are kept in a vector alongside the delegates, so adding a delegate binary
+     *  searches the priorities and then shifts the tail of both vectors, while every invoke method of
+     *  DelegateSet walks the delegates exactly as it would in an unordered set. The ordering costs nothing
+     *  at invocation time.
+     */
+    template <typename returnType, typename... parameters>
+    class PriorityDelegateSet : public AnnotatedDelegateSet<int, returnType, parameters...>
+    {
+        // Public Methods
+        public:
+            //! Helper typedef referring to the delegate type stored in this set.
+            typedef typename AnnotatedDelegateSet<int, returnType, parameters...>::StoredDelegateType StoredDelegateType;
+
+            //! The priority of delegates added with operator +=.
+            static const int DEFAULT_PRIORITY = 0;
+
+            /**
+             *  @brief Adds a delegate instance to the set, after every delegate of the same or a higher priority.
+             *  @param delegateInstance The delegate instance to add to the set.
+             *  @param priority The priority of the delegate. Delegates with higher priorities are invoked first.
+             *  @warning Ownership of the delegate will be given to the set, therefore the
+             *  given delegate should not be deleted manually.
+             */
+            void add(StoredDelegateType* delegateInstance, const int& priority)
+            {
+                const auto position = std::upper_bound(this->mAnnotations.begin(), this->mAnnotations.end(), priority, std::greater<int>());
+                this->insertAnnotated(position - this->mAnnotations.begin(), delegateInstance, priority);
+            }
+
+            /**
+             *  @brief Adds a delegate instance to the set with DEFAULT_PRIORITY.
+             *  @param delegateInstance The delegate instance to add to the set.
+             *  @warning Ownership of the delegate will be given to the set, therefore the
+             *  given delegate should not be deleted manually.
+             */
+            EASYDELEGATE_INLINE void operator +=(StoredDelegateType* delegateInstance)
+            {
+                this->add(delegateInstance, DEFAULT_PRIORITY);
+            }
+
+            /**
+             *  @brief Returns the priority of the delegate at the given index.
+             *  @param index The index of the delegate.
+             *  @return The priority the delegate was added with.
+             */
+            EASYDELEGATE_INLINE int getPriority(const size_t& index) const { return this->mAnnotations[index]; }
+    };
+
+    template <typename returnType, typename... parameters>
+    const int PriorityDelegateSet<returnType, parameters...>::DEFAULT_PRIORITY;
+} // End NameSpace EasyDelegate
+#endif // _INCLUDE_EASYDELEGATE_PRIORITYDELEGATESET_HPP_
@@ -0,0 +1,131 @@
+/**
+ *  @file probes.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the USDT probes that are compiled in when EASYDELEGATE_USDT_PROBES
+ *  is defined.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_PROBES_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_PROBES_HPP_
+
+#ifdef EASYDELEGATE_USDT_PROBES
+    #include <stddef.h>         // size_t
+    #include <sys/sdt.h>        // DTRACE_PROBE1, DTRACE_PROBE2, DTRACE_PROBE4
+
+    //! Fires the easydelegate:name probe with one argument.
+    #define EASYDELEGATE_PROBE1(name, a) DTRACE_PROBE1(easydelegate, name, a)
+    //! Fires the easydelegate:name probe with two arguments.
+    #define EASYDELEGATE_PROBE2(name, a, b) DTRACE_PROBE2(easydelegate, name, a, b)
+    //! Fires the easydelegate:name probe with four arguments.
+    #define EASYDELEGATE_PROBE4(name, a, b, c, d) DTRACE_PROBE4(easydelegate, name, a, b, c, d)
+
+namespace EasyDelegate
+{
+    /**
+     *  @brief Fires the easydelegate:invoke__entry probe when constructed and easydelegate:invoke__return
+     *  when it leaves scope, including when the invocation throws.
+     *  @details Both probes carry the address of the DelegateSet and the number of delegates in it at the
+     *  start of the invocation.
+     */
+    class BroadcastProbe
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the set being invoked.
+             *  @param delegateSet The DelegateSet being invoked.
+             *  @param delegateCount The number of delegates in the set.
+             */
+            EASYDELEGATE_INLINE BroadcastProbe(const void* delegateSet, const size_t& delegateCount) EASYDELEGATE_NOEXCEPT :
+            mDelegateSet(delegateSet), mDelegateCount(delegateCount)
+            {
+                EASYDELEGATE_PROBE2(invoke__entry, mDelegateSet, mDelegateCount);
+            }
+
+            //! Fires the return probe.
+            EASYDELEGATE_INLINE ~BroadcastProbe(void)
+            {
+                EASYDELEGATE_PROBE2(invoke__return, mDelegateSet, mDelegateCount);
+            }
+
+        // Private Members
+        private:
+            //! The DelegateSet being invoked.
+            const void* mDelegateSet;
+            //! The number of delegates in the set.
+            const size_t mDelegateCount;
+    };
+
+    /**
+     *  @brief Fires the easydelegate:listener__entry probe when constructed and easydelegate:listener__return
+     *  when it leaves scope, including when the delegate throws.
+     *  @details Both probes carry the address of the invoking DelegateSet, which is NULL for DeferredBroadcastCaller
+     *  snapshots, and the address of the delegate. The this pointer and static method of each delegate are
+     *  published once by easydelegate:add rather than on every call.
+     */
+    class ListenerProbe
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the delegate being invoked.
+             *  @param delegateSet The DelegateSet invoking the delegate, or NULL.
+             *  @param delegateInstance The delegate being invoked.
+             */
+            EASYDELEGATE_INLINE ListenerProbe(const void* delegateSet, const void* delegateInstance) EASYDELEGATE_NOEXCEPT :
+            mDelegateSet(delegateSet), mDelegate(delegateInstance)
+            {
+                EASYDELEGATE_PROBE2(listener__entry, mDelegateSet, mDelegate);
+            }
+
+            //! Fires the return probe.
+            EASYDELEGATE_INLINE ~ListenerProbe(void)
+            {
+                EASYDELEGATE_PROBE2(listener__return, mDelegateSet, mDelegate);
+            }
+
+        // Private Members
+        private:
+            //! The DelegateSet invoking the delegate, or NULL.
+            const void* mDelegateSet;
+            //! The delegate being invoked.
+            const void* mDelegate;
+    };
+
+    /**
+     *  @brief Fires the easydelegate:dispatch__entry probe when constructed and easydelegate:dispatch__return
+     *  when it leaves scope, including when the dispatch throws.
+     *  @details Both probes carry the address of the deferred caller being dispatched.
+     */
+    class DispatchProbe
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the deferred caller being dispatched.
+             *  @param caller The deferred caller being dispatched.
+             */
+            EASYDELEGATE_INLINE DispatchProbe(const void* caller) EASYDELEGATE_NOEXCEPT : mCaller(caller)
+            {
+                EASYDELEGATE_PROBE1(dispatch__entry, mCaller);
+            }
+
+            //! Fires the return probe.
+            EASYDELEGATE_INLINE ~DispatchProbe(void)
+            {
+                EASYDELEGATE_PROBE1(dispatch__return, mCaller);
+            }
+
+        // Private Members
+        private:
+            //! The deferred caller being dispatched.
+            const void* mCaller;
+    };
+} // End NameSpace EasyDelegate
+#endif // EASYDELEGATE_USDT_PROBES
+#endif // _INCLUDE_EASYDELEGATE_PROBES_HPP_
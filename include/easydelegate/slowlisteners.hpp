@@ -0,0 +1,204 @@
+/**
+ *  @file slowlisteners.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the slow listener detection that is compiled in when
+ *  EASYDELEGATE_SLOW_LISTENER_DETECTION is defined.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_SLOWLISTENERS_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_SLOWLISTENERS_HPP_
+
+#ifdef EASYDELEGATE_SLOW_LISTENER_DETECTION
+    #include <chrono>           // std::chrono::nanoseconds
+    #include <functional>       // std::function
+    #include <stddef.h>         // size_t
+    #include <stdint.h>         // uint64_t
+
+    #include "timing.hpp"
+
+namespace EasyDelegate
+{
+    class IDelegate;
+
+    //! A static method pointer with its signature erased. Cast it back to the real signature before calling it.
+    typedef void (*GenericMethodPointer)(void);
+
+    /**
+     *  @brief Describes a single listener invocation that exceeded its slow listener threshold.
+     */
+    struct SlowListenerEvent
+    {
+        //! The delegate that was invoked. Cast it to the ITypedDelegate of its DelegateSet to query callsMethod.
+        const IDelegate* mDelegate;
+        //! The DelegateSet that invoked the delegate, or NULL if it was invoked by a DeferredBroadcastCaller snapshot.
+        const void* mDelegateSet;
+        //! The this pointer of a member delegate, or NULL.
+        const void* mThisPointer;
+        //! The static method of a static delegate, or NULL.
+        GenericMethodPointer mStaticMethod;
+        //! The ITypedDelegate::getMethodHash of the delegate, identifying the class member method of a member delegate.
+        size_t mMethodHash;
+        //! How long the invocation took.
+        std::chrono::nanoseconds mDuration;
+        //! Whether or not the invocation ended with an exception.
+        bool mThrewException;
+    };
+
+    //! The callback fired for every slow listener invocation. It must not throw.
+    typedef std::function<void(const SlowListenerEvent&)> SlowListenerCallback;
+
+    /**
+     *  @brief A latency threshold paired with the callback fired when a listener invocation exceeds it.
+     *  @details Every DelegateSet has its own detector, and there is one global detector that is used for
+     *  any set whose own detector is disabled. Detectors should be configured before the sets using them
+     *  are invoked, as configuration is not synchronized with invocation.
+     */
+    class SlowListenerDetector
+    {
+        // Public Methods
+        public:
+            //! Standard constructor, creating a disabled detector.
+            SlowListenerDetector(void) : mThresholdTicks(0), mThreshold(0) { }
+
+            /**
+             *  @brief Returns the global detector.
+             *  @return A reference to the detector used by sets whose own detector is disabled.
+             */
+            static SlowListenerDetector& getGlobal(void)
+            {
+                static SlowListenerDetector global;
+                return global;
+            }
+
+            /**
+             *  @brief Returns the detector that applies to a set.
+             *  @param local The set's own detector, or NULL.
+             *  @return The local detector if it is enabled, otherwise the global detector if it is enabled,
+             *  otherwise NULL.
+             */
+            static EASYDELEGATE_INLINE const SlowListenerDetector* select(const SlowListenerDetector* local) EASYDELEGATE_NOEXCEPT
+            {
+                if (local && local->mThresholdTicks)
+                    return local;
+
+                const SlowListenerDetector& global = SlowListenerDetector::getGlobal();
+                return global.mThresholdTicks ? &global : NULL;
+            }
+
+            /**
+             *  @brief Enables the detector.
+             *  @param threshold Invocations taking longer than this fire the callback. Must be positive.
+             *  @param callback The callback to fire.
+             */
+            void setThreshold(const std::chrono::nanoseconds& threshold, const SlowListenerCallback& callback)
+            {
+                mThreshold = threshold;
+                mCallback = callback;
+
+                const uint64_t ticks = TimestampCounter::toTicks(threshold);
+                mThresholdTicks = ticks ? ticks : 1;
+            }
+
+            //! Disables the detector.
+            void clearThreshold(void)
+            {
+                mThresholdTicks = 0;
+                mThreshold = std::chrono::nanoseconds(0);
+                mCallback = SlowListenerCallback();
+            }
+
+            /**
+             *  @brief Returns the threshold of the detector.
+             *  @return The threshold, or zero if the detector is disabled.
+             */
+            EASYDELEGATE_INLINE const std::chrono::nanoseconds& getThreshold(void) const EASYDELEGATE_NOEXCEPT { return mThreshold; }
+
+            /**
+             *  @brief Returns the threshold of the detector in TimestampCounter ticks.
+             *  @return The threshold in ticks, or 0 if the detector is disabled.
+             */
+            EASYDELEGATE_INLINE uint64_t getThresholdTicks(void) const EASYDELEGATE_NOEXCEPT { return mThresholdTicks; }
+
+            /**
+             *  @brief Fires the callback.
+             *  @param event The slow invocation.
+             */
+            void fire(const SlowListenerEvent& event) const
+            {
+                mCallback(event);
+            }
+
+        // Private Members
+        private:
+            //! The threshold in TimestampCounter ticks, or 0 if the detector is disabled.
+            uint64_t mThresholdTicks;
+            //! The threshold.
+            std::chrono::nanoseconds mThreshold;
+            //! The callback to fire.
+            SlowListenerCallback mCallback;
+    };
+
+    /**
+     *  @brief Times a single listener invocation for as long as it is in scope and fires the slow listener
+     *  callback if it exceeded the threshold. Does nothing at all when no detector applies.
+     */
+    template <typename delegateType>
+    class SlowListenerTimer
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the detector and the invocation being timed.
+             *  @param detector The detector that applies, or NULL to time nothing.
+             *  @param delegateInstance The delegate being invoked.
+             *  @param delegateSet The DelegateSet invoking the delegate, or NULL.
+             */
+            EASYDELEGATE_INLINE SlowListenerTimer(const SlowListenerDetector* detector, const delegateType* delegateInstance, const void* delegateSet) EASYDELEGATE_NOEXCEPT :
+            mDetector(detector), mDelegate(delegateInstance), mDelegateSet(delegateSet), mThrewException(false), mStart(detector ? TimestampCounter::read() : 0) { }
+
+            //! Fires the callback if the invocation exceeded the threshold.
+            EASYDELEGATE_INLINE ~SlowListenerTimer(void)
+            {
+                if (!mDetector)
+                    return;
+
+                const uint64_t elapsed = TimestampCounter::read() - mStart;
+                if (elapsed <= mDetector->getThresholdTicks())
+                    return;
+
+                SlowListenerEvent event;
+                event.mDelegate = mDelegate;
+                event.mDelegateSet = mDelegateSet;
+                event.mThisPointer = mDelegate->getThisPointer();
+                event.mStaticMethod = reinterpret_cast<GenericMethodPointer>(mDelegate->getStaticMethodPointer());
+                event.mMethodHash = mDelegate->getMethodHash();
+                event.mDuration = TimestampCounter::toDuration(elapsed);
+                event.mThrewException = mThrewException;
+
+                mDetector->fire(event);
+            }
+
+            //! Marks the invocation as having ended with an exception.
+            EASYDELEGATE_INLINE void setThrewException(void) EASYDELEGATE_NOEXCEPT { mThrewException = true; }
+
+        // Private Members
+        private:
+            //! The detector that applies, or NULL.
+            const SlowListenerDetector* mDetector;
+            //! The delegate being invoked.
+            const delegateType* mDelegate;
+            //! The DelegateSet invoking the delegate, or NULL.
+            const void* mDelegateSet;
+            //! Whether or not the invocation ended with an exception.
+            bool mThrewException;
+            //! The tick count when the invocation started.
+            const uint64_t mStart;
+    };
+} // End NameSpace EasyDelegate
+#endif // EASYDELEGATE_SLOW_LISTENER_DETECTION
+#endif // _INCLUDE_EASYDELEGATE_SLOWLISTENERS_HPP_
@@ -0,0 +1,176 @@
+/**
+ *  @file statistics.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the per listener invocation statistics that are recorded when
+ *  EASYDELEGATE_LISTENER_STATISTICS is defined.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_STATISTICS_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_STATISTICS_HPP_
+
+#ifdef EASYDELEGATE_LISTENER_STATISTICS
+    #include <atomic>           // std::atomic
+    #include <chrono>           // std::chrono::steady_clock
+    #include <stdint.h>         // uint64_t
+
+    #include "timing.hpp"
+
+    #ifndef EASYDELEGATE_CACHE_LINE_SIZE
+        //! The cache line size that listener statistics are padded to. May be defined before inclusion.
+        #define EASYDELEGATE_CACHE_LINE_SIZE 64
+    #endif
+
+namespace EasyDelegate
+{
+    /**
+     *  @brief A copy of the invocation statistics of a single listener at some point in time.
+     *  @details When TimingSampler::setListenerInterval is above 1, the call count and total time are
+     *  estimates scaled up from the sampled calls. The exception count is always exact.
+     */
+    struct ListenerStatisticsSnapshot
+    {
+        //! The number of times the listener was invoked.
+        uint64_t mCallCount;
+        //! The number of invocations that were actually timed.
+        uint64_t mSampleCount;
+        //! The number of invocations that ended with an exception.
+        uint64_t mExceptionCount;
+
+        //! The total time spent invoking the listener.
+        std::chrono::nanoseconds mTotalTime;
+        //! The longest time spent in a single timed invocation of the listener.
+        std::chrono::nanoseconds mMaximumTime;
+
+        //! Standard constructor, zeroing all statistics.
+        ListenerStatisticsSnapshot(void) EASYDELEGATE_NOEXCEPT : mCallCount(0), mSampleCount(0), mExceptionCount(0), mTotalTime(0),
+        mMaximumTime(0) { }
+    };
+
+    /**
+     *  @brief The invocation statistics of a single listener.
+     *  @details Every counter is updated with relaxed atomics, so a listener may be invoked from several
+     *  threads at once and queried from any thread. Counters are not updated together, so a snapshot taken
+     *  while the listener is being invoked may be momentarily inconsistent.
+     *
+     *  The counters are padded by a cache line on either side, so that they never share a cache line with
+     *  anything else regardless of how the owning delegate was allocated.
+     */
+    class ListenerStatistics
+    {
+        // Public Methods
+        public:
+            //! Standard constructor, zeroing all statistics.
+            ListenerStatistics(void) EASYDELEGATE_NOEXCEPT : mCallCount(0), mSampleCount(0), mExceptionCount(0), mTotalTime(0), mMaximumTime(0) { }
+
+            /**
+             *  @brief Records a single timed invocation of the listener.
+             *  @param duration The time spent in the invocation.
+             *  @param weight The number of invocations the timed invocation stands for.
+             */
+            EASYDELEGATE_INLINE void record(const std::chrono::nanoseconds& duration, const unsigned int& weight) EASYDELEGATE_NOEXCEPT
+            {
+                const uint64_t nanoseconds = static_cast<uint64_t>(duration.count());
+
+                mCallCount.fetch_add(weight, std::memory_order_relaxed);
+                mSampleCount.fetch_add(1, std::memory_order_relaxed);
+                mTotalTime.fetch_add(nanoseconds * weight, std::memory_order_relaxed);
+
+                uint64_t maximum = mMaximumTime.load(std::memory_order_relaxed);
+                while (nanoseconds > maximum && !mMaximumTime.compare_exchange_weak(maximum, nanoseconds, std::memory_order_relaxed));
+            }
+
+            //! Records an invocation of the listener that ended with an exception.
+            EASYDELEGATE_INLINE void recordException(void) EASYDELEGATE_NOEXCEPT
+            {
+                mExceptionCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /**
+             *  @brief Returns a copy of the statistics.
+             *  @return A ListenerStatisticsSnapshot holding the current value of every counter.
+             */
+            ListenerStatisticsSnapshot getSnapshot(void) const EASYDELEGATE_NOEXCEPT
+            {
+                ListenerStatisticsSnapshot result;
+                result.mCallCount = mCallCount.load(std::memory_order_relaxed);
+                result.mSampleCount = mSampleCount.load(std::memory_order_relaxed);
+                result.mExceptionCount = mExceptionCount.load(std::memory_order_relaxed);
+                result.mTotalTime = std::chrono::nanoseconds(mTotalTime.load(std::memory_order_relaxed));
+                result.mMaximumTime = std::chrono::nanoseconds(mMaximumTime.load(std::memory_order_relaxed));
+
+                return result;
+            }
+
+            //! Resets all statistics to zero.
+            void reset(void) EASYDELEGATE_NOEXCEPT
+            {
+                mCallCount.store(0, std::memory_order_relaxed);
+                mSampleCount.store(0, std::memory_order_relaxed);
+                mExceptionCount.store(0, std::memory_order_relaxed);
+                mTotalTime.store(0, std::memory_order_relaxed);
+                mMaximumTime.store(0, std::memory_order_relaxed);
+            }
+
+        // Private Members
+        private:
+            //! Padding isolating the counters from whatever precedes them.
+            char mLeadingPadding[EASYDELEGATE_CACHE_LINE_SIZE];
+
+            //! The estimated number of times the listener was invoked.
+            std::atomic<uint64_t> mCallCount;
+            //! The number of invocations that were timed.
+            std::atomic<uint64_t> mSampleCount;
+            //! The number of invocations that ended with an exception.
+            std::atomic<uint64_t> mExceptionCount;
+            //! The estimated total time spent invoking the listener in nanoseconds.
+            std::atomic<uint64_t> mTotalTime;
+            //! The longest time spent in a single timed invocation of the listener in nanoseconds.
+            std::atomic<uint64_t> mMaximumTime;
+
+            //! Padding isolating the counters from whatever follows them.
+            char mTrailingPadding[EASYDELEGATE_CACHE_LINE_SIZE];
+    };
+
+    /**
+     *  @brief Times a single invocation of a listener for as long as it is in scope, recording the
+     *  result into the listener's statistics when it leaves scope.
+     *  @details Only invocations chosen by TimingSampler::sampleListener are timed.
+     */
+    class ListenerCallTimer
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the statistics to record into.
+             *  @param statistics The statistics of the listener being invoked.
+             */
+            EASYDELEGATE_INLINE ListenerCallTimer(ListenerStatistics& statistics) EASYDELEGATE_NOEXCEPT : mStatistics(statistics),
+            mWeight(TimingSampler::sampleListener()), mStart(mWeight ? TimestampCounter::read() : 0) { }
+
+            //! Records the invocation if it was timed.
+            EASYDELEGATE_INLINE ~ListenerCallTimer(void)
+            {
+                if (mWeight)
+                    mStatistics.record(TimestampCounter::toDuration(TimestampCounter::read() - mStart), mWeight);
+            }
+
+            //! Records that the invocation ended with an exception, whether or not it was timed.
+            EASYDELEGATE_INLINE void setThrewException(void) EASYDELEGATE_NOEXCEPT { mStatistics.recordException(); }
+
+        // Private Members
+        private:
+            //! The statistics to record into.
+            ListenerStatistics& mStatistics;
+            //! The number of invocations this invocation stands for, or 0 if it is not timed.
+            const unsigned int mWeight;
+            //! The tick count when the invocation started.
+            const uint64_t mStart;
+    };
+} // End NameSpace EasyDelegate
+#endif // EASYDELEGATE_LISTENER_STATISTICS
+#endif // _INCLUDE_EASYDELEGATE_STATISTICS_HPP_
@@ -0,0 +1,232 @@
+/**
+ *  @file timing.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the cheap timestamp counter used by the EasyDelegate instrumentation.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_TIMING_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_TIMING_HPP_
+
+#include <atomic>           // std::atomic
+#include <chrono>           // std::chrono::steady_clock
+#include <stdint.h>         // uint64_t
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>     // __rdtsc
+    #define EASYDELEGATE_HAS_TSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <x86intrin.h>  // __rdtsc
+    #define EASYDELEGATE_HAS_TSC
+#endif
+
+namespace EasyDelegate
+{
+    /**
+     *  @brief A cheap, monotonic tick counter for timing short intervals.
+     *  @details On x86 this reads the processor's timestamp counter, which costs a handful of cycles
+     *  rather than the system call or vDSO read behind std::chrono::steady_clock. Elsewhere it falls back
+     *  to std::chrono::steady_clock with one tick per nanosecond. Reads are not serializing, so intervals
+     *  are accurate to tens of cycles; that is plenty for detecting slow listeners.
+     */
+    class TimestampCounter
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Reads the counter.
+             *  @return The current tick count.
+             */
+            static EASYDELEGATE_INLINE uint64_t read(void) EASYDELEGATE_NOEXCEPT
+            {
+                #ifdef EASYDELEGATE_HAS_TSC
+                    return __rdtsc();
+                #else
+                    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+                #endif
+            }
+
+            /**
+             *  @brief Returns the number of ticks per nanosecond.
+             *  @return The tick rate, calibrated against std::chrono::steady_clock on first use.
+             *  @note The first call spins for about a millisecond to calibrate the counter.
+             */
+            static double getTicksPerNanosecond(void)
+            {
+                static const double ticksPerNanosecond = TimestampCounter::calibrate();
+                return ticksPerNanosecond;
+            }
+
+            /**
+             *  @brief Converts a duration to ticks.
+             *  @param duration The duration to convert.
+             *  @return The number of ticks in the duration.
+             */
+            static uint64_t toTicks(const std::chrono::nanoseconds& duration)
+            {
+                return static_cast<uint64_t>(duration.count() * TimestampCounter::getTicksPerNanosecond());
+            }
+
+            /**
+             *  @brief Converts a number of ticks to a duration.
+             *  @param ticks The number of ticks to convert.
+             *  @return The duration of the ticks.
+             */
+            static std::chrono::nanoseconds toDuration(const uint64_t& ticks)
+            {
+                return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(ticks / TimestampCounter::getTicksPerNanosecond()));
+            }
+
+        // Private Methods
+        private:
+            //! Measures the tick rate against std::chrono::steady_clock.
+            static double calibrate(void)
+            {
+                #ifdef EASYDELEGATE_HAS_TSC
+                    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+                    const uint64_t startTicks = TimestampCounter::read();
+
+                    std::chrono::steady_clock::time_point endTime;
+                    do
+                        endTime = std::chrono::steady_clock::now();
+                    while (endTime - startTime < std::chrono::milliseconds(1));
+
+                    const uint64_t endTicks = TimestampCounter::read();
+                    return static_cast<double>(endTicks - startTicks) / std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+                #else
+                    return 1.0;
+                #endif
+            }
+    };
+
+    /**
+     *  @brief Decides which broadcasts and listener calls the instrumentation times.
+     *  @details With an interval of N, on average one in every N listener calls or broadcasts on each thread
+     *  is timed. The decision is a per thread countdown, so the untimed path costs a thread local decrement and
+     *  a branch rather than two TimestampCounter reads. Each time the countdown expires it is reloaded with a
+     *  gap drawn uniformly from 1 to 2N - 1, so that sets whose size is a multiple of N do not always time the
+     *  same listener. Sampled results are weighted by the interval, so totals become estimates while percentiles
+     *  and maximums are simply drawn from fewer samples. The default interval of 1 times everything.
+     *
+     *  Slow listener detection is never sampled, as the one slow call it exists to catch could be skipped.
+     */
+    class TimingSampler
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Sets how often listener calls are timed for listener statistics.
+             *  @param interval One in this many listener calls is timed. 0 is treated as 1.
+             *  @note Threads pick up the new interval once their current countdown expires.
+             */
+            static void setListenerInterval(const unsigned int& interval) EASYDELEGATE_NOEXCEPT
+            {
+                TimingSampler::getListenerIntervalStorage().store(interval ? interval : 1, std::memory_order_relaxed);
+            }
+
+            /**
+             *  @brief Returns how often listener calls are timed.
+             *  @return One in this many listener calls is timed.
+             */
+            static unsigned int getListenerInterval(void) EASYDELEGATE_NOEXCEPT
+            {
+                return TimingSampler::getListenerIntervalStorage().load(std::memory_order_relaxed);
+            }
+
+            /**
+             *  @brief Sets how often broadcasts are timed for broadcast latency histograms.
+             *  @param interval One in this many broadcasts is timed. 0 is treated as 1.
+             *  @note Threads pick up the new interval once their current countdown expires.
+             */
+            static void setBroadcastInterval(const unsigned int& interval) EASYDELEGATE_NOEXCEPT
+            {
+                TimingSampler::getBroadcastIntervalStorage().store(interval ? interval : 1, std::memory_order_relaxed);
+            }
+
+            /**
+             *  @brief Returns how often broadcasts are timed.
+             *  @return One in this many broadcasts is timed.
+             */
+            static unsigned int getBroadcastInterval(void) EASYDELEGATE_NOEXCEPT
+            {
+                return TimingSampler::getBroadcastIntervalStorage().load(std::memory_order_relaxed);
+            }
+
+            /**
+             *  @brief Decides whether the calling thread's next listener call is timed.
+             *  @return 0 if the call is not timed, otherwise the number of calls the timed call stands for.
+             */
+            static EASYDELEGATE_INLINE unsigned int sampleListener(void) EASYDELEGATE_NOEXCEPT
+            {
+                static thread_local Countdown countdown;
+                return TimingSampler::sample(countdown, TimingSampler::getListenerIntervalStorage());
+            }
+
+            /**
+             *  @brief Decides whether the calling thread's next broadcast is timed.
+             *  @return 0 if the broadcast is not timed, otherwise the number of broadcasts the timed broadcast
+             *  stands for.
+             */
+            static EASYDELEGATE_INLINE unsigned int sampleBroadcast(void) EASYDELEGATE_NOEXCEPT
+            {
+                static thread_local Countdown countdown;
+                return TimingSampler::sample(countdown, TimingSampler::getBroadcastIntervalStorage());
+            }
+
+        // Private Members
+        private:
+            //! The per thread state of one sampling decision.
+            struct Countdown
+            {
+                //! Standard constructor. The first event is always timed.
+                Countdown(void) EASYDELEGATE_NOEXCEPT : mRemaining(1), mRandom(0x9E3779B9u) { }
+
+                //! The number of events left until the next timed event.
+                unsigned int mRemaining;
+                //! The xorshift state the gaps are drawn from.
+                uint32_t mRandom;
+            };
+
+        // Private Methods
+        private:
+            //! Counts down, returning the interval and drawing the next gap whenever the countdown expires.
+            static EASYDELEGATE_INLINE unsigned int sample(Countdown& countdown, const std::atomic<unsigned int>& interval) EASYDELEGATE_NOEXCEPT
+            {
+                if (--countdown.mRemaining)
+                    return 0;
+
+                const unsigned int result = interval.load(std::memory_order_relaxed);
+                if (result == 1)
+                {
+                    countdown.mRemaining = 1;
+                    return result;
+                }
+
+                countdown.mRandom ^= countdown.mRandom << 13;
+                countdown.mRandom ^= countdown.mRandom >> 17;
+                countdown.mRandom ^= countdown.mRandom << 5;
+                countdown.mRemaining = 1 + countdown.mRandom % (2 * result - 1);
+
+                return result;
+            }
+
+            //! Returns the listener sampling interval.
+            static std::atomic<unsigned int>& getListenerIntervalStorage(void) EASYDELEGATE_NOEXCEPT
+            {
+                static std::atomic<unsigned int> interval(1);
+                return interval;
+            }
+
+            //! Returns the broadcast sampling interval.
+            static std::atomic<unsigned int>& getBroadcastIntervalStorage(void) EASYDELEGATE_NOEXCEPT
+            {
+                static std::atomic<unsigned int> interval(1);
+                return interval;
+            }
+    };
+} // End NameSpace EasyDelegate
+#endif // _INCLUDE_EASYDELEGATE_TIMING_HPP_
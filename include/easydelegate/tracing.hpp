@@ -0,0 +1,359 @@
+/**
+ *  @file tracing.hpp
+ *  @date 10/16/2026
+ *  @version 3.0
+ *  @brief Include file declaring the dispatch tracing backend that records events when
+ *  EASYDELEGATE_TRACING is defined and writes them as Chrome Trace Event JSON.
+ *  @author <a href="http://dx.no-ip.org">Robert MacGregor</a>
+ *
+ *  @copyright This software is licensed under the MIT license. Refer to LICENSE.txt for more
+ *	information.
+ */
+
+#if !defined(_INCLUDE_EASYDELEGATE_TRACING_HPP_) && ISCPP11
+#define _INCLUDE_EASYDELEGATE_TRACING_HPP_
+
+#ifdef EASYDELEGATE_TRACING
+    #include <atomic>           // std::atomic
+    #include <chrono>           // std::chrono::steady_clock
+    #include <mutex>            // std::mutex, std::lock_guard
+    #include <ostream>          // std::ostream
+    #include <stdint.h>         // uint64_t
+    #include <stdio.h>          // snprintf
+    #include <vector>           // std::vector
+
+    #ifndef EASYDELEGATE_TRACE_BUFFER_SIZE
+        //! The number of events each thread can buffer between flushes. Must be a power of two. May be defined before inclusion.
+        #define EASYDELEGATE_TRACE_BUFFER_SIZE 16384
+    #endif
+
+namespace EasyDelegate
+{
+    /**
+     *  @brief A single recorded trace event.
+     */
+    struct TraceEvent
+    {
+        //! The name of the event. Must be a string literal or otherwise outlive the tracer.
+        const char* mName;
+        //! The Chrome Trace Event phase: 'X' for a complete span, 's' and 'f' for the start and finish of a flow.
+        char mPhase;
+        //! The time the event started, in nanoseconds since the tracer was created.
+        uint64_t mTimestamp;
+        //! The duration of a complete span in nanoseconds.
+        uint64_t mDuration;
+        //! The flow ID linking flow events together, or 0 for spans.
+        uint64_t mFlowID;
+        //! An optional pointer written as an argument of the event, such as the delegate invoked.
+        const void* mPointer;
+    };
+
+    /**
+     *  @brief A single producer, single consumer ring of trace events owned by one thread.
+     *  @details The owning thread appends events without locking. Events are dropped rather than
+     *  overwritten when the ring is full, so a flush never observes a partially written event.
+     */
+    class TraceBuffer
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the ID of the owning thread.
+             *  @param threadID The ID written as the tid of every event in this buffer.
+             */
+            TraceBuffer(const unsigned int& threadID) : mThreadID(threadID), mEvents(EASYDELEGATE_TRACE_BUFFER_SIZE),
+            mWriteIndex(0), mReadIndex(0), mDroppedCount(0) { }
+
+            /**
+             *  @brief Appends an event. Must only be called from the owning thread.
+             *  @param event The event to append.
+             */
+            EASYDELEGATE_INLINE void push(const TraceEvent& event) EASYDELEGATE_NOEXCEPT
+            {
+                const size_t writeIndex = mWriteIndex.load(std::memory_order_relaxed);
+
+                if (writeIndex - mReadIndex.load(std::memory_order_acquire) >= EASYDELEGATE_TRACE_BUFFER_SIZE)
+                {
+                    mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                mEvents[writeIndex & (EASYDELEGATE_TRACE_BUFFER_SIZE - 1)] = event;
+                mWriteIndex.store(writeIndex + 1, std::memory_order_release);
+            }
+
+            /**
+             *  @brief Removes every event appended so far, passing each to the given callback. Must only be
+             *  called by one consumer at a time.
+             *  @param callback A callable accepting the thread ID and a const TraceEvent&.
+             */
+            template <typename callbackType>
+            void consume(callbackType callback)
+            {
+                const size_t readIndex = mReadIndex.load(std::memory_order_relaxed);
+                const size_t writeIndex = mWriteIndex.load(std::memory_order_acquire);
+
+                for (size_t index = readIndex; index != writeIndex; ++index)
+                    callback(mThreadID, mEvents[index & (EASYDELEGATE_TRACE_BUFFER_SIZE - 1)]);
+
+                mReadIndex.store(writeIndex, std::memory_order_release);
+            }
+
+            /**
+             *  @brief Returns the number of events dropped because the buffer was full.
+             *  @return The number of dropped events.
+             */
+            EASYDELEGATE_INLINE size_t getDroppedCount(void) const EASYDELEGATE_NOEXCEPT { return mDroppedCount.load(std::memory_order_relaxed); }
+
+        // Private Members
+        private:
+            //! The ID of the owning thread.
+            const unsigned int mThreadID;
+            //! The ring of events.
+            std::vector<TraceEvent> mEvents;
+
+            //! The total number of events appended. Only written by the owning thread.
+            std::atomic<size_t> mWriteIndex;
+            //! The total number of events consumed. Only written by the consumer.
+            std::atomic<size_t> mReadIndex;
+            //! The number of events dropped because the buffer was full.
+            std::atomic<size_t> mDroppedCount;
+    };
+
+    /**
+     *  @brief The process wide tracer, owning a TraceBuffer for every thread that recorded an event.
+     *  @details Recording an event only touches the calling thread's buffer. Buffers outlive their threads,
+     *  so events recorded by a thread that has since exited are still written by the next flush.
+     */
+    class Tracer
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Returns the process wide tracer.
+             *  @return A reference to the tracer.
+             */
+            static Tracer& getInstance(void)
+            {
+                static Tracer instance;
+                return instance;
+            }
+
+            //! Standard destructor.
+            ~Tracer(void)
+            {
+                for (auto it = mBuffers.begin(); it != mBuffers.end(); it++)
+                    delete *it;
+            }
+
+            /**
+             *  @brief Returns the current time on the tracer's clock.
+             *  @return The time in nanoseconds since the tracer was created.
+             */
+            EASYDELEGATE_INLINE uint64_t now(void) const EASYDELEGATE_NOEXCEPT
+            {
+                return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mEpoch).count());
+            }
+
+            /**
+             *  @brief Allocates a new flow ID used to link the events of a deferred call.
+             *  @return A flow ID that is never 0.
+             */
+            EASYDELEGATE_INLINE uint64_t allocateFlowID(void) EASYDELEGATE_NOEXCEPT { return mNextFlowID.fetch_add(1, std::memory_order_relaxed); }
+
+            /**
+             *  @brief Records an event into the calling thread's buffer.
+             *  @param event The event to record.
+             */
+            EASYDELEGATE_INLINE void record(const TraceEvent& event)
+            {
+                this->getThreadBuffer().push(event);
+            }
+
+            /**
+             *  @brief Records a complete span.
+             *  @param name The name of the span.
+             *  @param start The start of the span on the tracer's clock.
+             *  @param end The end of the span on the tracer's clock.
+             *  @param pointer An optional pointer written as an argument of the span.
+             */
+            EASYDELEGATE_INLINE void recordSpan(const char* name, const uint64_t& start, const uint64_t& end, const void* pointer=NULL)
+            {
+                const TraceEvent event = { name, 'X', start, end - start, 0, pointer };
+                this->record(event);
+            }
+
+            /**
+             *  @brief Records the start or finish of a flow.
+             *  @param phase 's' to start the flow or 'f' to finish it.
+             *  @param flowID The ID of the flow.
+             *  @param timestamp The time of the flow event, which should be within the span it belongs to.
+             */
+            EASYDELEGATE_INLINE void recordFlow(const char& phase, const uint64_t& flowID, const uint64_t& timestamp)
+            {
+                const TraceEvent event = { "deferred call", phase, timestamp, 0, flowID, NULL };
+                this->record(event);
+            }
+
+            /**
+             *  @brief Writes every event recorded since the previous flush as a Chrome Trace Event JSON document,
+             *  which both chrome://tracing and Perfetto can open.
+             *  @param out The stream to write to.
+             *  @note Each flush writes a complete document holding only the events recorded since the previous flush.
+             */
+            void flush(std::ostream& out)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+
+                out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+                bool first = true;
+                for (auto it = mBuffers.begin(); it != mBuffers.end(); it++)
+                    (*it)->consume([&](const unsigned int& threadID, const TraceEvent& event)
+                    {
+                        out << (first ? "\n" : ",\n");
+                        Tracer::writeEvent(out, threadID, event);
+                        first = false;
+                    });
+
+                out << "\n]}\n";
+            }
+
+            /**
+             *  @brief Returns the number of events dropped by all threads because their buffers were full.
+             *  @return The number of dropped events.
+             */
+            size_t getDroppedCount(void)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+
+                size_t result = 0;
+                for (auto it = mBuffers.begin(); it != mBuffers.end(); it++)
+                    result += (*it)->getDroppedCount();
+
+                return result;
+            }
+
+        // Private Methods
+        private:
+            //! Standard constructor.
+            Tracer(void) : mEpoch(std::chrono::steady_clock::now()), mNextFlowID(1) { }
+
+            //! Returns the calling thread's buffer, creating it on first use.
+            TraceBuffer& getThreadBuffer(void)
+            {
+                static thread_local TraceBuffer* buffer = NULL;
+
+                if (!buffer)
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+
+                    buffer = new TraceBuffer(static_cast<unsigned int>(mBuffers.size() + 1));
+                    mBuffers.push_back(buffer);
+                }
+
+                return *buffer;
+            }
+
+            //! Writes a single event as a JSON object.
+            static void writeEvent(std::ostream& out, const unsigned int& threadID, const TraceEvent& event)
+            {
+                // Chrome Trace Event timestamps are in microseconds
+                char timestamp[32];
+                snprintf(timestamp, sizeof(timestamp), "%llu.%03llu", static_cast<unsigned long long>(event.mTimestamp / 1000),
+                static_cast<unsigned long long>(event.mTimestamp % 1000));
+
+                out << "{\"name\":\"" << event.mName << "\",\"cat\":\"easydelegate\",\"ph\":\"" << event.mPhase << "\",\"ts\":" << timestamp
+                    << ",\"pid\":1,\"tid\":" << threadID;
+
+                if (event.mPhase == 'X')
+                {
+                    char duration[32];
+                    snprintf(duration, sizeof(duration), "%llu.%03llu", static_cast<unsigned long long>(event.mDuration / 1000),
+                    static_cast<unsigned long long>(event.mDuration % 1000));
+
+                    out << ",\"dur\":" << duration;
+                }
+                else
+                {
+                    // Bind the flow to the span enclosing it on both ends
+                    out << ",\"id\":" << event.mFlowID << ",\"bp\":\"e\"";
+                }
+
+                if (event.mPointer)
+                {
+                    char pointer[32];
+                    snprintf(pointer, sizeof(pointer), "%p", event.mPointer);
+
+                    out << ",\"args\":{\"pointer\":\"" << pointer << "\"}";
+                }
+
+                out << "}";
+            }
+
+        // Private Members
+        private:
+            //! The time the tracer was created. Every timestamp is relative to this.
+            const std::chrono::steady_clock::time_point mEpoch;
+            //! The next flow ID to allocate.
+            std::atomic<uint64_t> mNextFlowID;
+
+            //! Guards the list of buffers and serializes flushes.
+            std::mutex mMutex;
+            //! The buffer of every thread that recorded an event.
+            std::vector<TraceBuffer*> mBuffers;
+    };
+
+    /**
+     *  @brief Records a complete span covering the lifetime of this object.
+     */
+    class TraceScope
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the name of the span.
+             *  @param name The name of the span. Must be a string literal or otherwise outlive the tracer.
+             *  @param pointer An optional pointer written as an argument of the span.
+             */
+            EASYDELEGATE_INLINE TraceScope(const char* name, const void* pointer=NULL) : mName(name), mPointer(pointer),
+            mStart(Tracer::getInstance().now()) { }
+
+            /**
+             *  @brief Constructor accepting the name of the span and a flow that starts or finishes within it.
+             *  @param name The name of the span. Must be a string literal or otherwise outlive the tracer.
+             *  @param pointer An optional pointer written as an argument of the span.
+             *  @param flowPhase 's' if the flow starts within this span or 'f' if it finishes within this span.
+             *  @param flowID The ID of the flow.
+             */
+            EASYDELEGATE_INLINE TraceScope(const char* name, const void* pointer, const char& flowPhase, const uint64_t& flowID) : mName(name),
+            mPointer(pointer), mStart(Tracer::getInstance().now())
+            {
+                Tracer::getInstance().recordFlow(flowPhase, flowID, mStart);
+            }
+
+            //! Records the span.
+            EASYDELEGATE_INLINE ~TraceScope(void)
+            {
+                Tracer& tracer = Tracer::getInstance();
+                tracer.recordSpan(mName, mStart, tracer.now(), mPointer);
+            }
+
+            /**
+             *  @brief Returns the time the span started.
+             *  @return The start of the span on the tracer's clock.
+             */
+            EASYDELEGATE_INLINE uint64_t getStart(void) const EASYDELEGATE_NOEXCEPT { return mStart; }
+
+        // Private Members
+        private:
+            //! The name of the span.
+            const char* mName;
+            //! The pointer written as an argument of the span.
+            const void* mPointer;
+            //! The time the span started.
+            const uint64_t mStart;
+    };
+} // End NameSpace EasyDelegate
+#endif // EASYDELEGATE_TRACING
+#endif // _INCLUDE_EASYDELEGATE_TRACING_HPP_
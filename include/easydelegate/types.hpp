@@ -10,7 +10,9 @@
  *	information.
  */
 
-#ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+#if ISCPP11
+    #include <stddef.h>     // size_t
+    #include <string.h>     // memcpy
     #include <tuple>        // std::tuple<...>
     #include <type_traits>  // std::remove_reference<type>
 #endif
@@ -20,10 +22,10 @@
 
 namespace EasyDelegate
 {
-   #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
+    #if ISCPP11
         /**
          *  @brief Part of a helper template that is used to statically unpack tuples for
-         *  the deferring calling system.
+         *  the deferred calling system and lazy invocation.
          *
          *  @details Taken from the chosen answer of http://stackoverflow.com/questions/7858817/unpacking-a-tuple-to-call-a-matching-function-pointer
          */
@@ -31,7 +33,7 @@ namespace EasyDelegate
 
         /**
          *  @brief Part of a helper template that is used to statically unpack tuples for
-         *  the deferring calling system.
+         *  the deferred calling system and lazy invocation.
          *
          *  @details Taken from the chosen answer of http://stackoverflow.com/questions/7858817/unpacking-a-tuple-to-call-a-matching-function-pointer
          */
@@ -39,7 +41,7 @@ namespace EasyDelegate
 
         /**
          *  @brief Part of a helper template that is used to statically unpack tuples for
-         *  the deferring calling system.
+         *  the deferred calling system and lazy invocation.
          *
          *  @details Taken from the chosen answer of http://stackoverflow.com/questions/7858817/unpacking-a-tuple-to-call-a-matching-function-pointer
          */
@@ -48,9 +50,7 @@ namespace EasyDelegate
             //! Helper in the expansion logic.
             typedef seq<S...> type;
         };
-    #endif
 
-    #ifndef EASYDELEGATE_NO_DEFERRED_CALLING
         /**
          *  @brief A helper typedef for an std::tuple that removes the reference from referenced types.
          *
@@ -58,7 +58,40 @@ namespace EasyDelegate
          */
         template <typename... typenames>
         using NoReferenceTuple = std::tuple<typename std::remove_reference<typenames>::type...>;
-    #endif // EASYDELEGATE_NO_DEFERRED_CALLING
+
+        /**
+         *  @brief Helper template whose static member has a unique address for every type, allowing types to be
+         *  identified without RTTI.
+         */
+        template <typename type>
+        struct TypeTag
+        {
+            //! The member whose address identifies the type.
+            static const char sTag;
+        };
+
+        template <typename type>
+        const char TypeTag<type>::sTag = 0;
+
+        /**
+         *  @brief Hashes the representation of a static or class member method pointer.
+         *  @param typeTag The TypeTag address of the delegate or deferred caller type holding the method pointer.
+         *  @param methodPointer The method pointer to hash.
+         *  @return A hash of the holder type and the method pointer.
+         */
+        template <typename methodPointerType>
+        size_t hashMethodPointer(const void* typeTag, const methodPointerType& methodPointer) EASYDELEGATE_NOEXCEPT
+        {
+            size_t words[(sizeof(methodPointerType) + sizeof(size_t) - 1) / sizeof(size_t)] = { 0 };
+            memcpy(words, &methodPointer, sizeof(methodPointerType));
+
+            size_t hash = reinterpret_cast<size_t>(typeTag);
+            for (size_t word = 0; word < sizeof(words) / sizeof(size_t); ++word)
+                hash = hash * 31 + words[word];
+
+            return hash;
+        }
+    #endif
 
     #if ISCPP11
         //! Helper typedef to a pointer of a static method with the given signature.